@@ -116,6 +116,7 @@ void displayProducts(const vector<RecycledProduct>& products);
 void selectProduct(vector<RecycledProduct>& products, vector<CartItem>& cart);
 void displayCart(const vector<CartItem>& cart);
 void checkout(const vector<CartItem>& cart);
+double calculateCheckoutTotal(const vector<CartItem>& cart, double& discount);
 void loadProducts(vector<RecycledProduct>& products);
 void saveCart(const vector<CartItem>& cart);
 void loadCart(vector<CartItem>& cart, const vector<RecycledProduct>& products);
@@ -568,6 +569,22 @@ void displayCart(const vector<CartItem>& cart) {
 }
 
 
+// Function to compute the cart subtotal and the discount applied at checkout
+double calculateCheckoutTotal(const vector<CartItem>& cart, double& discount) {
+    double grandTotal = 0.0;
+    for (const auto& item : cart) {
+        grandTotal += item.quantity * item.product.price;
+    }
+
+    // Apply discounts
+    discount = 0.0;
+    if (grandTotal > 1000.0) {
+        discount = grandTotal * 0.10; // 10% discount for purchases above 1000
+    }
+
+    return grandTotal;
+}
+
 // Function to handle checkout process
 // Function to handle the checkout process
 void checkout(const vector<CartItem>& cart) {
@@ -576,15 +593,9 @@ void checkout(const vector<CartItem>& cart) {
         return;
     }
 
-    double grandTotal = 0.0;
-    for (const auto& item : cart) {
-        grandTotal += item.quantity * item.product.price;
-    }
-
-    // Apply discounts
     double discount = 0.0;
-    if (grandTotal > 1000.0) {
-        discount = grandTotal * 0.10; // 10% discount for purchases above 1000
+    double grandTotal = calculateCheckoutTotal(cart, discount);
+    if (discount > 0.0) {
         cout << "\nCongratulations! You received a 10% discount for spending over 1000.\n";
     }
 
@@ -959,6 +970,17 @@ void selectCompany() {
     }
 }
 
+// Default catalogue of recycled products
+vector<RecycledProduct> defaultRecycledProducts() {
+    return {
+        {"Plastic", "Recycled Plastic Bag", 25.50},
+        {"Metal", "Recycled Aluminum Can", 15.75},
+        {"Paper", "Recycled Notebook", 35.00},
+        {"Glass", "Recycled Glass Jar", 50.00},
+        {"E-Waste", "Refurbished Smartphone", 3500.00}
+    };
+}
+
 int sellrecycled() {
     vector<RecycledProduct> products;
     vector<CartItem> cart;
@@ -974,13 +996,7 @@ int sellrecycled() {
     if (products.empty()) {
         // If no products are loaded, use default values
         cout << ".\n";
-        products = {
-            {"Plastic", "Recycled Plastic Bag", 25.50},
-            {"Metal", "Recycled Aluminum Can", 15.75},
-            {"Paper", "Recycled Notebook", 35.00},
-            {"Glass", "Recycled Glass Jar", 50.00},
-            {"E-Waste", "Refurbished Smartphone", 3500.00}
-        };
+        products = defaultRecycledProducts();
     }
 
 
@@ -1058,6 +1074,68 @@ int sellrecycled() {
 #include <regex>
 #include <fstream>
 #include <algorithm>
+#include <unordered_map>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <set>
+#include <numeric>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <list>
+#include <deque>
+#include <cmath>
+#include <cstring>
+#include <cstdio>
+#include <filesystem>
+#include <string_view>
+
+
+// Read-only view of a whole file, memory-mapped where the platform allows
+// (defined after the platform headers, near the end of the file)
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return opened; }
+    const char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+
+private:
+    const char* bytes = nullptr;
+    std::size_t length = 0;
+    bool opened = false;
+};
+
+
+// Where the route menu keeps its allocation history between runs
+const char* const ALLOCATION_LOG_FILE = "allocations.bwal";
+
+
+// Appends the bytes of a plain value to a binary record
+template <typename T>
+void appendBinary(std::string& buffer, const T& value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+
+// Reads a plain value from [at, end), advancing at; false if too few bytes are left
+template <typename T>
+bool readBinary(const char*& at, const char* end, T& value)
+{
+    if (static_cast<std::size_t>(end - at) < sizeof(value))
+        return false;
+    std::memcpy(&value, at, sizeof(value));
+    at += sizeof(value);
+    return true;
+}
 
 
 class Vehicle
@@ -1107,4799 +1185,11517 @@ class Waste
 public:
     std::string area;
     int quantity;
+    // Index of area in the road network, resolved once when the waste is added
+    int areaId;
+    bool isAllotted;
 
     Waste(std::string a, int q)
      {
         area = a;
         quantity = q;
+        areaId = -1;
+        isAllotted = false;
     }
 
 };
 
 
-// Struct to hold allocation details
-
-struct AllocationDetail
+// A one-way road between two areas, used when building the road network
+struct RoadEdge
 {
-
-    std::string vehicleModel;
-    std::string driverName;
-    std::string wasteArea;
-    double fuelRequired;
-    // Added route
-    std::vector<std::string> route;
-
+    int from;
+    int to;
+    int weight;
 };
 
 
-class BelgaumWasteManagement
+// Road speed over the day as (minute of day, km/h) breakpoints, linear in between and
+// wrapping from the last breakpoint round to the first; one profile is shared by many roads
+struct SpeedProfile
 {
+    std::string name;
+    std::vector<std::pair<double, double>> points;
 
-private:
-    std::vector<Vehicle> vehicles;
-    std::vector<Driver> drivers;
-    std::vector<Waste> wastes;
-    // Graph for routes
-    std::vector<std::vector<std::pair<int, int>>> graph;
-    // Areas for destination
-    std::vector<std::string> areas;
-    // Map to store allocations by date
-    std::map<std::string, std::vector<AllocationDetail>> allocations;
+    // The segment around minuteOfDay as (start minute, start speed, end minute, end speed);
+    // the wrapping segment is shifted by a day so that start <= minuteOfDay < end
+    void segmentAt(double minuteOfDay, double& a, double& va, double& b, double& vb) const
+    {
+        std::size_t i = std::upper_bound(points.begin(), points.end(), std::make_pair(minuteOfDay, 1e300)) - points.begin();
+        if (i == 0)
+        {
+            a = points.back().first - 1440;
+            va = points.back().second;
+            b = points.front().first;
+            vb = points.front().second;
+        }
+        else if (i == points.size())
+        {
+            a = points.back().first;
+            va = points.back().second;
+            b = points.front().first + 1440;
+            vb = points.front().second;
+        }
+        else
+        {
+            a = points[i - 1].first;
+            va = points[i - 1].second;
+            b = points[i].first;
+            vb = points[i].second;
+        }
+    }
 
+    // Minutes needed to drive km leaving at startMinute (minutes since midnight of the
+    // dispatch day). Speed is a function of the clock, so leaving later never means
+    // arriving earlier - the FIFO property time-dependent Dijkstra relies on
+    double travelMinutes(double km, double startMinute) const
+    {
+        if (points.size() == 1)
+        {
+            return km * 60 / points[0].second;
+        }
 
+        double t = startMinute;
+        double remaining = km;
+        while (remaining > 0)
+        {
+            double day = std::floor(t / 1440) * 1440;
+            double a, va, b, vb;
+            segmentAt(t - day, a, va, b, vb);
+
+            double slope = (vb - va) / (b - a);
+            double v0 = va + slope * (t - day - a);
+            double span = b - (t - day);
+            double covered = (v0 * span + slope * span * span / 2) / 60;
+            if (covered >= remaining)
+            {
+                // Solve remaining = (v0 d + slope d^2 / 2) / 60 for d, in the form that
+                // stays accurate when the slope is close to zero
+                double root = std::sqrt(std::max(0.0, v0 * v0 + 2 * slope * 60 * remaining));
+                return t + 120 * remaining / (v0 + root) - startMinute;
+            }
+            remaining -= covered;
+            t += span;
+        }
+        return t - startMinute;
+    }
+};
 
-public:
-    BelgaumWasteManagement()
 
-    {
-        // Initialize areas and graph
-        areas =
-         {
+// Reads a clock time "hh:mm" as minutes since midnight
+bool parseClockTime(const std::string& text, double& minute)
+{
+    int hours = 0, minutes = 0;
+    char colon = 0;
+    std::istringstream in(text);
+    if (!(in >> hours >> colon >> minutes) || colon != ':' || hours < 0 || hours > 23 || minutes < 0 || minutes > 59)
+        return false;
+
+    minute = hours * 60 + minutes;
+    return true;
+}
 
-            "Kanabargi", "Belgaum", "Shivaji Nagar", "Tilakwadi", "Chennamma Nagar",
 
-            "Gandhinagar", "APMC Yard", "City Market", "Fort Road", "Engg College Road",
+// Layouts accepted by parseDate
+enum class DateFormat
+{
+    DayMonthYear,   // dd/mm/yyyy, used by route allotments
+    YearMonthDay    // yyyy-mm-dd, used by waste records and their CSV files
+};
 
-            "Khanapur Road", "Udyambag", "Bogarves", "Goaves", "Hindwadi",
 
-            "Mache", "Malmaruti", "Nemgoa", "Shahpur", "Sambhaji Nagar",
+// Day number (days since 01/01/1970) of a calendar date, counting years from March
+// so the leap day falls at the end of the year
+int daysFromCivil(int year, int month, int day)
+{
+    year -= month <= 2;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
 
-            "Angol", "Balekundri", "Camp", "Dharamnath", "Fort Lake"
 
-        };
+// Parses a date in the given layout, digits and separators exactly as shown and the
+// day checked against the month's length (leap years included). Stores the day
+// number on success. Hand-written so bulk imports do not pay for a std::regex
+bool parseDate(std::string_view text, DateFormat format, int& dayNumber)
+{
+    if (text.size() != 10)
+        return false;
 
+    bool dayFirst = format == DateFormat::DayMonthYear;
+    char separator = dayFirst ? '/' : '-';
+    if (text[dayFirst ? 2 : 4] != separator || text[dayFirst ? 5 : 7] != separator)
+        return false;
 
-        graph =
-         {
+    auto number = [&text](int at, int width, int& value)
+    {
+        value = 0;
+        for (int k = at; k < at + width; k++)
+        {
+            if (text[k] < '0' || text[k] > '9')
+                return false;
+            value = value * 10 + (text[k] - '0');
+        }
+        return true;
+    };
 
-           // Kanabargi
-            {{1, 10}, {2, 15}, {4, 20}},
+    int day, month, year;
+    if (!number(dayFirst ? 0 : 8, 2, day) || !number(dayFirst ? 3 : 5, 2, month) || !number(dayFirst ? 6 : 0, 4, year))
+        return false;
 
-            // Belgaum
-            {{0, 10}, {3, 25}, {5, 15}},
+    static const int monthLength[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    if (month < 1 || month > 12 || day < 1 || day > monthLength[month - 1] + (month == 2 && leap))
+        return false;
 
-            // Shivaji Nagar
-            {{0, 15}, {3, 10}, {6, 20}},
+    dayNumber = daysFromCivil(year, month, day);
+    return true;
+}
 
-             // Tilakwadi
-            {{1, 25}, {2, 10}, {7, 30}},
 
-            // Chennamma Nagar
-            {{0, 20}, {5, 25}, {8, 15}},
+// Day number of a dd/mm/yyyy date already checked by isValidDate; dates compare
+// chronologically as day numbers
+int dateToDayNumber(const std::string& date)
+{
+    int dayNumber = 0;
+    parseDate(date, DateFormat::DayMonthYear, dayNumber);
+    return dayNumber;
+}
 
-             // Gandhinagar
-            {{1, 15}, {4, 25}, {9, 10}},
 
-             // APMC Yard
-            {{2, 20}, {10, 25}},
+// The dd/mm/yyyy form of a day number
+std::string dayNumberToDate(int dayNumber)
+{
+    dayNumber += 719468;
+    int era = (dayNumber >= 0 ? dayNumber : dayNumber - 146096) / 146097;
+    int dayOfEra = dayNumber - era * 146097;
+    int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int shiftedMonth = (5 * dayOfYear + 2) / 153;
+    int day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+    int month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+    int year = yearOfEra + era * 400 + (month <= 2);
+
+    char text[32];
+    std::snprintf(text, sizeof(text), "%02d/%02d/%04d", day, month, year);
+    return text;
+}
 
-            // City Market
-            {{3, 30}, {11, 15}},
 
-              // Fort Road
-            {{4, 15}, {12, 20}},
+// Formats minutes since midnight as "hh:mm", noting when the time falls on a later day
+std::string formatClockTime(double minute)
+{
+    long total = static_cast<long>(minute);
+    long days = total / 1440;
+    char text[32];
+    std::snprintf(text, sizeof(text), "%02ld:%02ld", (total % 1440) / 60, total % 60);
+    return days > 0 ? std::string(text) + " (+" + std::to_string(days) + " day)" : std::string(text);
+}
 
-             // Engg College Road
-            {{5, 10}, {13, 30}},
 
-             // Khanapur Road
-            {{6, 25}, {14, 35}},
+// A road or shortcut in the contraction hierarchy; a shortcut replaces the two arcs
+// through a contracted area (firstChild then secondChild), roads have no children
+struct HierarchyArc
+{
+    int from;
+    int to;
+    int weight;
+    int firstChild;
+    int secondChild;
+};
 
-             // Udyambag
-            {{7, 15}, {15, 20}},
 
-              // Bogarves
-            {{8, 20}, {16, 10}},
+// Point-to-point shortest route algorithms, selectable per query
+enum class RouteAlgorithm
+{
+    Dijkstra,       // full single-source search
+    EarlyExit,      // Dijkstra that stops once the destination is settled
+    Bidirectional,  // Dijkstra from both ends until the searches meet
+    AStar,          // Dijkstra guided by straight-line distance to the destination
+    Hierarchy       // upward searches in the contraction hierarchy (built on first use)
+};
 
-              // Goaves
-            {{9, 30}, {17, 25}},
 
-              // Hindwadi
-            {{10, 35}, {18, 15}},
+// Reads an algorithm name as used by the batch commands
+bool parseRouteAlgorithm(const std::string& name, RouteAlgorithm& algorithm)
+{
+    if (name == "dijkstra") algorithm = RouteAlgorithm::Dijkstra;
+    else if (name == "early-exit") algorithm = RouteAlgorithm::EarlyExit;
+    else if (name == "bidirectional") algorithm = RouteAlgorithm::Bidirectional;
+    else if (name == "astar") algorithm = RouteAlgorithm::AStar;
+    else if (name == "ch") algorithm = RouteAlgorithm::Hierarchy;
+    else return false;
+    return true;
+}
 
-              // Mache
-            {{11, 20}, {19, 10}},
 
-            // Malmaruti
-            {{12, 10}, {20, 30}},
+// Vehicle choice for the fleet simulator
+enum class AllocationPolicy
+{
+    FirstFit,   // lowest-numbered free vehicle that holds the pile
+    BestFit     // free vehicle with the least spare capacity, as allotVehicle does
+};
 
-            // Nemgoa
-            {{13, 25}, {21, 15}},
 
-            // Shahpur
-            {{14, 15}, {22, 20}},
+// Reads a policy name as used by the batch commands
+bool parseAllocationPolicy(const std::string& name, AllocationPolicy& policy)
+{
+    if (name == "first-fit") policy = AllocationPolicy::FirstFit;
+    else if (name == "best-fit") policy = AllocationPolicy::BestFit;
+    else return false;
+    return true;
+}
 
-            // Sambhaji Nagar
-            {{15, 10}, {23, 25}},
 
-              // Angol
-            {{16, 30}, {24, 20}},
+// A waste pile reported during a simulated day
+struct WasteArrival
+{
+    double minute;   // minutes since midnight
+    int areaId;
+    int quantity;
+};
 
-             // Balekundri
-            {{17, 15}},
 
-              // Camp
-            {{18, 20}},
+// Outcome of one simulated day
+struct SimulationReport
+{
+    int arrived = 0;
+    int served = 0;
+    int rejected = 0;                 // larger than every vehicle, or no route to the area
+    long long collectedKg = 0;
+    double startMinute = 0;           // first arrival
+    double endMinute = 0;             // last vehicle back at Kanabargi
+    double busyVehicleMinutes = 0;
+    int vehicleCount = 0;
+    double totalWaitMinutes = 0;      // arrival to dispatch, over served piles
+    double maxWaitMinutes = 0;
+    double distanceKm = 0;
+    double fuelLiters = 0;
+};
 
-              // Dharamnath
-            {{19, 25}},
 
-                // Fort Lake
-            {{20, 20}}
+// A fleet mix for the scenario runner: how many of each catalogue vehicle, and drivers
+struct FleetScenario
+{
+    std::vector<int> vehicleCounts;
+    int drivers;
+};
 
-        };
 
-    }
+// Least-recently-used cache of shortest routes keyed by (source, destination, graph
+// version). Entries of an older road network are never hit again and simply age out
+class RouteCache
+{
+public:
+    struct Entry
+    {
+        std::shared_ptr<const std::vector<int>> path;   // area indexes, empty if unreachable
+        int distance = 0;
+    };
 
-    // Function to get the index of an area
-    int getAreaIndex(const std::string& areaName)
-     {
+    explicit RouteCache(std::size_t capacity) : capacity(std::max<std::size_t>(1, capacity)) {}
 
-        for (int i = 0; i < areas.size(); i++)
-          {
-            if (areas[i] == areaName)
-            {
-                return i;
-            }
+    // The cached entry, now most recently used, or nullptr
+    Entry* find(int source, int destination, int version)
+    {
+        auto it = index.find(key(source, destination, version));
+        if (it == index.end())
+        {
+            misses++;
+            return nullptr;
         }
-        // Return -1 if area is not found
-        return -1;
+        hits++;
+        order.splice(order.begin(), order, it->second);
+        return &it->second->second;
     }
 
+    Entry& insert(int source, int destination, int version, Entry entry)
+    {
+        if (order.size() >= capacity)
+        {
+            index.erase(order.back().first);
+            order.pop_back();
+        }
+        order.emplace_front(key(source, destination, version), std::move(entry));
+        index[order.front().first] = order.begin();
+        return order.front().second;
+    }
 
-    // Add Vehicle
-    void addVehicle(Vehicle v)
+    void setCapacity(std::size_t newCapacity)
     {
-        vehicles.push_back(v);
+        capacity = std::max<std::size_t>(1, newCapacity);
+        while (order.size() > capacity)
+        {
+            index.erase(order.back().first);
+            order.pop_back();
+        }
     }
 
+    std::size_t size() const { return order.size(); }
+    std::size_t getCapacity() const { return capacity; }
+    long long getHits() const { return hits; }
+    long long getMisses() const { return misses; }
 
-    // Add Driver
-    void addDriver(Driver d)
+private:
+    struct Key
     {
+        int source, destination, version;
+        bool operator==(const Key& other) const
+        {
+            return source == other.source && destination == other.destination && version == other.version;
+        }
+    };
 
-        drivers.push_back(d);
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& k) const
+        {
+            std::uint64_t h = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(k.source)) << 32) |
+                              static_cast<std::uint32_t>(k.destination);
+            return std::hash<std::uint64_t>()(h * 0x9E3779B97F4A7C15ULL ^ static_cast<std::uint32_t>(k.version));
+        }
+    };
+
+    static Key key(int source, int destination, int version)
+    {
+        return {source, destination, version};
     }
 
+    std::size_t capacity;
+    std::list<std::pair<Key, Entry>> order;
+    std::unordered_map<Key, std::list<std::pair<Key, Entry>>::iterator, KeyHash> index;
+    long long hits = 0;
+    long long misses = 0;
+};
 
-    // Add waste
-    void addWaste(Waste w)
-     {
-        wastes.push_back(w);
-    }
 
+// Each distinct string stored once under a dense id (from 0) that never changes
+class StringInterner
+{
+public:
+    std::int32_t intern(std::string_view text)
+    {
+        auto it = ids.find(text);
+        if (it != ids.end())
+            return it->second;
 
-    // Assuming constant speed in km/h for simplicity (40 km/h)
-    // average
+        strings.emplace_back(text);
+        std::int32_t id = static_cast<std::int32_t>(strings.size() - 1);
+        ids.emplace(strings.back(), id);
+        return id;
+    }
 
-    const double VEHICLE_SPEED = 40.0;
+    // Id of text, or -1 if it was never interned
+    std::int32_t find(std::string_view text) const
+    {
+        auto it = ids.find(text);
+        return it == ids.end() ? -1 : it->second;
+    }
 
+    const std::string& operator[](std::int32_t id) const { return strings[id]; }
+    std::size_t size() const { return strings.size(); }
 
-    // Function to calculate travel time (in hours) based on distance and speed
-    double calculateTravelTime(double distance)
+    void clear()
     {
-        return distance / VEHICLE_SPEED;
+        ids.clear();
+        strings.clear();
     }
 
+private:
+    // A deque never moves its elements, so the views in ids stay valid
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, std::int32_t> ids;
+};
+
 
-// Dijkstra's Algorithm for finding the shortest path from a source to a destination in a weighted graph
-std::vector<int> dijkstra(int source, int destination, std::vector<int>& parent)
+// A route stored in a RouteArena: length ids from position begin
+struct RouteSpan
 {
+    std::uint32_t begin = 0;
+    std::uint32_t length = 0;
+};
 
-    // Initialize the number of nodes in the graph
-    int n = graph.size();
 
-    // Initialize distance vector with maximum possible values (infinity) to indicate that initially all nodes are unreachable
-    std::vector<int> distance(n, std::numeric_limits<int>::max());
+// The routes of every allocation back to back as interned area name ids. A route equal
+// to one stored before reuses its span, so a year of trips to the same few areas holds
+// each route once
+class RouteArena
+{
+public:
+    RouteSpan add(const std::vector<std::int32_t>& route)
+    {
+        // FNV-1a over the ids
+        std::uint64_t hash = 1469598103934665603ULL;
+        for (std::int32_t id : route)
+        {
+            hash = (hash ^ static_cast<std::uint32_t>(id)) * 1099511628211ULL;
+        }
 
-    // Initialize the parent vector to store the path information
-    parent.assign(n, -1);
+        auto [it, added] = byHash.emplace(hash, RouteSpan());
+        if (!added && equals(it->second, route))
+            return it->second;
 
-    // Distance to the source itself is always 0
-    distance[source] = 0;
+        RouteSpan span{static_cast<std::uint32_t>(ids.size()), static_cast<std::uint32_t>(route.size())};
+        ids.insert(ids.end(), route.begin(), route.end());
+        if (added)
+            it->second = span;
+        return span;
+    }
 
-    // Min-heap priority queue to select the node with the smallest distance
-    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>> pq;
-    pq.push({0, source});
+    const std::int32_t* begin(RouteSpan span) const { return ids.data() + span.begin; }
+    const std::int32_t* end(RouteSpan span) const { return ids.data() + span.begin + span.length; }
 
-    // Continue until all nodes processed or priority queue is empty
-    while (!pq.empty())
+    bool equals(RouteSpan span, const std::vector<std::int32_t>& route) const
+    {
+        return span.length == route.size() && std::equal(route.begin(), route.end(), begin(span));
+    }
+
+    std::size_t size() const { return ids.size(); }
 
+    void clear()
     {
-        // Extract the node with the smallest distance
-        auto [dist, node] = pq.top();
-        pq.pop();
+        ids.clear();
+        byHash.clear();
+    }
 
-        // If the current distance is greater than the recorded distance, skip processing
-        if (dist > distance[node]) continue;
+private:
+    std::vector<std::int32_t> ids;
+    // First route stored with each hash
+    std::unordered_map<std::uint64_t, RouteSpan> byHash;
+};
 
-        // Explore all the neighbors of the current node
-        for (const auto& [neighbor, weight] : graph[node])
-        {
 
-            // Calculate new distance for the neighbor
-            int newDist = distance[node] + weight;
+// Struct to hold allocation details: names are ids in the allocation StringInterner and
+// the route a span of area name ids in the RouteArena, so a record is 40 bytes
 
-            // If the new distance is shorter, update the distance and parent
-            if (newDist < distance[neighbor])
-            {
-                distance[neighbor] = newDist;
-                parent[neighbor] = node;
+struct AllocationDetail
+{
 
-                // Push the updated distance and neighbor node into the priority queue
-                pq.push({newDist, neighbor});
-            }
+    std::int32_t vehicleModel;
+    std::int32_t driverName;
+    // For display: the waste areas joined with ", "
+    std::int32_t wasteArea;
+    // Added route
+    RouteSpan route;
+    // The waste areas collected from, in order, as area name ids in the RouteArena
+    RouteSpan stops;
+    // Index of the vehicle in the fleet that made the trip, -1 if not known (older logs)
+    std::int32_t vehicle;
+    double fuelRequired;
 
-        }
+};
+
+
+// Trips, fuel and CO2 for one vehicle model, driver, waste area or day
+struct FuelTotals
+{
+    int trips = 0;
+    double fuelLiters = 0;
+    double co2Kg = 0;
+};
 
+
+// Fuel and emissions totals by vehicle model, driver, waste area and day, updated as each
+// allocation is recorded or re-planned (a few hash lookups on interned ids) so reports
+// never rescan the allocations. A tour's fuel is shared equally among the areas it
+// collects from. Rows are keyed by allocation string id; the reports take the interner
+// to print their names
+class FuelLedger
+{
+public:
+    // Tailpipe CO2 per litre of diesel burned
+    static constexpr double CO2_KG_PER_LITRE = 2.68;
+
+    // arena holds the detail's stops
+    void add(int day, const AllocationDetail& detail, const RouteArena& arena) { apply(day, detail, arena, 1); }
+    void remove(int day, const AllocationDetail& detail, const RouteArena& arena) { apply(day, detail, arena, -1); }
+
+    void clear()
+    {
+        totals = FuelTotals();
+        byVehicle.clear();
+        byDriver.clear();
+        byArea.clear();
+        byDay.clear();
     }
 
-    // Check if the destination is reachable
-    if (distance[destination] == std::numeric_limits<int>::max())
+    const FuelTotals& total() const { return totals; }
+    // By allocation string id
+    FuelTotals vehicle(std::int32_t model) const { return find(byVehicle, model); }
+    FuelTotals driver(std::int32_t name) const { return find(byDriver, name); }
+    FuelTotals area(std::int32_t name) const { return find(byArea, name); }
+    FuelTotals day(int dayNumber) const { return find(byDay, dayNumber); }
+
+    // Sum over days fromDay to toDay inclusive; visits only the days that had trips
+    FuelTotals between(int fromDay, int toDay) const
     {
-        std::cout << "No path exists from " << areas[source] << " to " << areas[destination] << "." << std::endl;
-        return {};
+        FuelTotals sum;
+        for (auto it = byDay.lower_bound(fromDay); it != byDay.end() && it->first <= toDay; ++it)
+        {
+            sum.trips += it->second.trips;
+            sum.fuelLiters += it->second.fuelLiters;
+            sum.co2Kg += it->second.co2Kg;
+        }
+        return sum;
     }
 
-    // Return the distance vector containing shortest distances from the source to all nodes
-    return distance;
-}
+    // One of "vehicles", "drivers", "areas" or "days", highest fuel first (days in date
+    // order); false for an unknown kind
+    bool printReport(const std::string& kind, const StringInterner& names, std::ostream& out) const
+    {
+        std::vector<std::pair<std::string, FuelTotals>> rows;
+        if (!collect(kind, names, rows))
+            return false;
+        if (kind != "days")
+        {
+            // Ties by name, so the order does not depend on the hash maps
+            std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+                return a.second.fuelLiters > b.second.fuelLiters || (a.second.fuelLiters == b.second.fuelLiters && a.first < b.first);
+            });
+        }
 
+        out << std::left << std::setw(24) << kind << std::setw(8) << "Trips" << std::setw(14) << "Fuel (L)" << "CO2 (kg)" << "\n";
+        out << std::string(56, '-') << "\n";
+        for (const auto& [key, row] : rows)
+        {
+            out << std::left << std::setw(24) << key << std::setw(8) << row.trips << std::setw(14) << row.fuelLiters << row.co2Kg << "\n";
+        }
+        out << std::left << std::setw(24) << "Total" << std::setw(8) << totals.trips << std::setw(14) << totals.fuelLiters
+            << totals.co2Kg << "\n";
+        return true;
+    }
 
-// Function to find the longest path using modified DFS (Depth-First Search)
-void findLongestPath(int source, std::vector<int>& dist, std::vector<int>& parent)
-{
+    // CSV of every aggregate: kind,key,trips,fuel_liters,co2_kg
+    bool exportCsv(const std::string& filename, const StringInterner& names) const
+    {
+        std::ofstream outFile(filename);
+        if (!outFile)
+        {
+            std::cerr << "Error: Unable to open '" << filename << "' for writing.\n";
+            return false;
+        }
 
-    // Initialize the visited vector to keep track of visited nodes
-    std::vector<bool> visited(areas.size(), false);
+        outFile << "kind,key,trips,fuel_liters,co2_kg\n";
+        for (const char* kind : {"vehicles", "drivers", "areas", "days"})
+        {
+            std::vector<std::pair<std::string, FuelTotals>> rows;
+            collect(kind, names, rows);
+            for (const auto& [key, row] : rows)
+            {
+                outFile << kind << ",\"" << key << "\"," << row.trips << ',' << row.fuelLiters << ',' << row.co2Kg << '\n';
+            }
+        }
+        outFile << "total,,"<< totals.trips << ',' << totals.fuelLiters << ',' << totals.co2Kg << '\n';
+        return static_cast<bool>(outFile);
+    }
 
-    // Initialize the distance vector with the minimum possible values (negative infinity)
-    dist.assign(areas.size(), std::numeric_limits<int>::min());
+private:
+    FuelTotals totals;
+    std::unordered_map<std::int32_t, FuelTotals> byVehicle;
+    std::unordered_map<std::int32_t, FuelTotals> byDriver;
+    std::unordered_map<std::int32_t, FuelTotals> byArea;
+    std::map<int, FuelTotals> byDay;
 
-    // Initialize the parent vector to keep track of the path
-    parent.assign(areas.size(), -1);
+    static void addTo(FuelTotals& row, int trips, double fuel)
+    {
+        row.trips += trips;
+        row.fuelLiters += fuel;
+        row.co2Kg += fuel * CO2_KG_PER_LITRE;
+    }
 
-    // Distance to the source itself is always 0
-    dist[source] = 0;
+    // addTo on rows[key], dropping the row once its last trip is removed
+    template <typename Rows, typename Key>
+    static void addTo(Rows& rows, const Key& key, int trips, double fuel)
+    {
+        auto it = rows.try_emplace(key).first;
+        addTo(it->second, trips, fuel);
+        if (it->second.trips == 0)
+            rows.erase(it);
+    }
 
-    // Perform DFS from each node to find the longest path
-    for (int i = 0; i < areas.size(); i++)
+    void apply(int day, const AllocationDetail& detail, const RouteArena& arena, int sign)
     {
-        // Start DFS from unvisited nodes
-        if (!visited[i])
+        double fuel = sign * detail.fuelRequired;
+        addTo(totals, sign, fuel);
+        addTo(byVehicle, detail.vehicleModel, sign, fuel);
+        addTo(byDriver, detail.driverName, sign, fuel);
+        addTo(byDay, day, sign, fuel);
+
+        for (const std::int32_t* stop = arena.begin(detail.stops); stop != arena.end(detail.stops); ++stop)
         {
-            dfsLongestPath(i, visited, dist, parent);
+            addTo(byArea, *stop, sign, fuel / detail.stops.length);
         }
     }
 
-}
-
+    template <typename Key>
+    static FuelTotals find(const std::unordered_map<Key, FuelTotals>& rows, const Key& key)
+    {
+        auto it = rows.find(key);
+        return it == rows.end() ? FuelTotals() : it->second;
+    }
 
-// Helper function for DFS to find the longest path
-void dfsLongestPath(int u, std::vector<bool>& visited, std::vector<int>& dist, std::vector<int>& parent)
-{
-    // Mark the current node as visited
-    visited[u] = true;
+    static FuelTotals find(const std::map<int, FuelTotals>& rows, int key)
+    {
+        auto it = rows.find(key);
+        return it == rows.end() ? FuelTotals() : it->second;
+    }
 
-    // Explore all adjacent nodes (neighbors)
-    for (const auto& [v, weight] : graph[u])
+    bool collect(const std::string& kind, const StringInterner& names, std::vector<std::pair<std::string, FuelTotals>>& rows) const
     {
-        // Check if the path through the current node u is longer
-        if (dist[u] + weight > dist[v])
+        const std::unordered_map<std::int32_t, FuelTotals>* source =
+            kind == "vehicles" ? &byVehicle : kind == "drivers" ? &byDriver : kind == "areas" ? &byArea : nullptr;
+        if (source != nullptr)
+        {
+            for (const auto& [id, row] : *source)
+            {
+                rows.push_back({names[id], row});
+            }
+        }
+        else if (kind == "days")
         {
-            // Update the distance and parent for the neighbor node
-            dist[v] = dist[u] + weight;
-            parent[v] = u;
+            for (const auto& [dayNumber, row] : byDay)
+            {
+                rows.push_back({dayNumberToDate(dayNumber), row});
+            }
         }
-
-        // Perform DFS on unvisited neighbors
-        if (!visited[v])
+        else
         {
-            dfsLongestPath(v, visited, dist, parent);
+            return false;
         }
+        return true;
     }
-}
+};
 
 
-    // Function to validate date format (dd/mm/yyyy)
-  bool isValidDate(const std::string& date)
+class BelgaumWasteManagement
 {
-    // Define a regular expression pattern to match dates in the format dd/mm/yyyy
-    // \b asserts a word boundary to ensure the date is a complete word
-    // (0[1-9]|[12][0-9]|3[01]) matches the day part, allowing values from 01 to 31
-    // (0[1-9]|1[0-2]) matches the month part, allowing values from 01 to 12
-    // ([0-9]{4}) matches the year part, allowing any four-digit number
-    const std::regex pattern(R"(\b(0[1-9]|[12][0-9]|3[01])/(0[1-9]|1[0-2])/([0-9]{4})\b)");
 
-    // Use std::regex_match to check if the input date matches the pattern
-    return std::regex_match(date, pattern);
+private:
+    std::vector<Vehicle> vehicles;
+    std::vector<Driver> drivers;
+    std::vector<Waste> wastes;
+    // Road network in compressed sparse row form: the roads leaving area u are
+    // edgeTargets/edgeWeights[edgeOffsets[u] .. edgeOffsets[u + 1])
+    std::vector<int> edgeOffsets;
+    std::vector<int> edgeTargets;
+    std::vector<int> edgeWeights;
+    // Areas for destination
+    std::vector<std::string> areas;
+    // Area coordinates in degrees, NaN where unknown
+    std::vector<double> areaLatitude;
+    std::vector<double> areaLongitude;
+    // Area name -> index into areas
+    std::unordered_map<std::string, int> areaIndex;
+    // Allocations by day number (see dateToDayNumber), so dates iterate chronologically
+    // and a date range is a lower_bound away
+    std::map<int, std::vector<AllocationDetail>> allocations;
+    // Vehicle models, driver names and areas of the allocations, and their routes
+    StringInterner allocationStrings;
+    RouteArena routeArena;
+    // Per vehicle model, its trips as (day number, position in that day's list), in order
+    std::unordered_map<std::string, std::vector<std::pair<int, int>>> vehicleHistory;
+    // Running fuel and CO2 totals over allocations
+    FuelLedger fuelLedger;
+    // Recently used shortest routes
+    RouteCache routeCache{4096};
+
+    // All-pairs shortest path table (distance and next hop), built from the road network
+    // Only kept for networks up to ALL_PAIRS_LIMIT areas; larger ones use Dijkstra
+    static const int ALL_PAIRS_LIMIT = 2000;
+    // Largest area and road counts a text network may declare or use, checked before anything is allocated
+    static const long TEXT_AREA_LIMIT = 1L << 25;
+    static const long TEXT_ROAD_LIMIT = 1L << 27;
+    std::vector<std::vector<int>> allPairsDistance;
+    std::vector<std::vector<int>> allPairsNext;
+    // Bumped whenever the road network changes; the table is rebuilt when it is out of date
+    int graphVersion = 0;
+    int allPairsVersion = -1;
+
+    // Roads reversed (CSR keyed by the area a road arrives at), for bidirectional search
+    std::vector<int> reverseOffsets;
+    std::vector<int> reverseSources;
+    std::vector<int> reverseWeights;
+    int reverseVersion = -1;
+
+    // km of road per km of straight line, at least; 0 when A* has no usable coordinates
+    double heuristicScale = 0.0;
+    int heuristicVersion = -1;
+
+    // Algorithm for point-to-point queries on networks too large for the all-pairs table
+    RouteAlgorithm routeAlgorithm = RouteAlgorithm::Bidirectional;
+
+    // Time-of-day speed profiles; profile 0 is the flat VEHICLE_SPEED. Each road names its
+    // profile in one byte (edgeProfile, parallel to edgeTargets, empty while all are flat)
+    std::vector<SpeedProfile> speedProfiles;
+    std::vector<std::uint8_t> edgeProfile;
+    // Minute of the day vehicles leave Kanabargi, used for allotment ETAs
+    double dispatchMinute = 6 * 60;
+
+    // Contraction hierarchy: every road and shortcut, the order areas were contracted in,
+    // and two CSR views - arcs leaving an area upwards (to a later-contracted area) and
+    // arcs arriving at an area from above, which the backward search walks in reverse
+    std::vector<HierarchyArc> hierarchyArcs;
+    std::vector<int> hierarchyRank;
+    std::vector<int> upOffsets, upArcs;
+    std::vector<int> downOffsets, downArcs;
+    int hierarchyVersion = -1;
+    // Per-query scratch space, reset through the touched list rather than reallocated
+    std::vector<long long> hierarchyDistance[2];
+    std::vector<int> hierarchyParent[2];
+    std::vector<int> hierarchyTouched;
+
+    // Free vehicles ordered by (loadCapacity, index) so the tightest fit is one lower_bound away
+    std::multiset<std::pair<int, int>> freeVehicles;
+    // Indexes of drivers that are not on a route, lowest index first
+    std::set<int> freeDrivers;
+
+    // Append-only allocation log (see openAllocationLog) and the ids of the strings
+    // already written to it
+    std::string allocationLogName;
+    std::ofstream allocationLog;
+    std::unordered_map<std::string, std::int32_t> allocationLogStrings;
+    // allocationStrings id -> log string id, -1 until first written
+    std::vector<std::int32_t> allocationLogIds;
+
 
-}
 
+public:
+    // Longest routes are exact: bitmask DP up to LONGEST_DP_LIMIT areas, branch and bound
+    // (visited areas kept in a 64-bit mask) up to LONGEST_SEARCH_LIMIT. The search gives up
+    // after LONGEST_SEARCH_BUDGET expansions (about a second) rather than run for minutes
+    static const int LONGEST_DP_LIMIT = 18;
+    static const int LONGEST_SEARCH_LIMIT = 64;
+    static const long long LONGEST_SEARCH_BUDGET = 2000000;
+    // Most seeds a tour plan is tried from (one plan each is kept in memory)
+    static const int TOUR_STARTS_LIMIT = 1024;
+
+    BelgaumWasteManagement()
 
-    // Function to allot a vehicle for a waste collection task
-    void allotVehicle(int wasteIndex)
     {
+        speedProfiles.push_back({"flat", {{0.0, VEHICLE_SPEED}}});
 
-        if (wasteIndex < wastes.size())
-          {
-            int requiredCapacity = wastes[wasteIndex].quantity;
-            std::string date;
-            std::cout << "Enter the date for allotment (dd/mm/yyyy): ";
-            std::cin >> date;
-            while (!isValidDate(date))
-             {
+        // Initialize areas and graph
+        std::vector<std::string> defaultAreas =
+         {
 
-                std::cout << "Invalid date format. Please enter the date in the format dd/mm/yyyy: ";
-                std::cin >> date;
-            }
+            "Kanabargi", "Belgaum", "Shivaji Nagar", "Tilakwadi", "Chennamma Nagar",
 
-            for (int i = 0; i < vehicles.size(); i++)
-              {
-                if (vehicles[i].loadCapacity >= requiredCapacity && !vehicles[i].isAllotted)
-                {
-                    vehicles[i].isAllotted = true;
-             // Assuming first driver is allotted for simplicity
-                    drivers[0].isAllotted = true;
-                    std::cout << "Vehicle allotted : " << vehicles[i].vehicleModel << std::endl;
-                    std::cout << "  Driver name : " << drivers[0].name << " from " << drivers[0].address
-                              << " for waste in " << wastes[wasteIndex].area << " on " << date << std::endl;
-                    std::cout << " Driver address :" << drivers[0].address << std::endl;
-                    std::cout << "Route details from Kanabargi to " << wastes[wasteIndex].area << ":\n";
-                    int source = 0;  // Kanabargi
-                    int destination = getAreaIndex(wastes[wasteIndex].area);
-
-                    if (destination != -1)
-
-                      {
-                        std::vector<int> parent;
-                        std::vector<int> distance = dijkstra(source, destination, parent);
-                        if (distance[destination] == std::numeric_limits<int>::max())
+            "Gandhinagar", "APMC Yard", "City Market", "Fort Road", "Engg College Road",
 
-                        {
-                            std::cout << "No route found to the destination." << std::endl;
-                            return;
-                        }
+            "Khanapur Road", "Udyambag", "Bogarves", "Goaves", "Hindwadi",
 
-                        std::stack<int> path;
-                        std::vector<std::string> route;
-                        for (int at = destination; at != -1; at = parent[at])
+            "Mache", "Malmaruti", "Nemgoa", "Shahpur", "Sambhaji Nagar",
 
-                          {
-                            path.push(at);
-                        }
-                        while (!path.empty())
+            "Angol", "Balekundri", "Camp", "Dharamnath", "Fort Lake"
 
-                        {
-                            std::cout << areas[path.top()] << (path.size() > 1 ? " -> " : "");
-                            route.push_back(areas[path.top()]);
-                            path.pop();
+        };
 
-                        }
-                        std::cout << std::endl;
 
-                        double totalDistance = distance[destination];
-                        double travelTime = calculateTravelTime(totalDistance);
-                        int hours = static_cast<int>(travelTime);
-                        int minutes = static_cast<int>((travelTime - hours) * 60);
+        std::vector<std::vector<std::pair<int, int>>> graph =
+         {
 
-                        std::cout << "Total Distance: " << totalDistance << " km\n";
+           // Kanabargi
+            {{1, 10}, {2, 15}, {4, 20}},
 
-                        std::cout << "This vehicle will be free in " << hours << " hours and " << minutes << " minutes." << std::endl;
+            // Belgaum
+            {{0, 10}, {3, 25}, {5, 15}},
 
-                        double fuelRequired = totalDistance / vehicles[i].mileage;
+            // Shivaji Nagar
+            {{0, 15}, {3, 10}, {6, 20}},
 
-                        std::cout << "Fuel Required: " << fuelRequired << " liters\n";
+             // Tilakwadi
+            {{1, 25}, {2, 10}, {7, 30}},
 
-                        allocations[date].push_back({vehicles[i].vehicleModel, drivers[0].name, wastes[wasteIndex].area, fuelRequired, route});
+            // Chennamma Nagar
+            {{0, 20}, {5, 25}, {8, 15}},
 
-                        std::cout << " =========================================================" << std::endl;
+             // Gandhinagar
+            {{1, 15}, {4, 25}, {9, 10}},
 
-                    }
-                    else
-                      {
-                        std::cout << "Error: Invalid destination area." << std::endl;
-                    }
+             // APMC Yard
+            {{2, 20}, {10, 25}},
 
-                    return;
-                }
-            }
+            // City Market
+            {{3, 30}, {11, 15}},
 
-            std::cout << "No suitable vehicle available." << std::endl;
-        }
-        else
-          {
-            std::cout << "Invalid waste index." << std::endl;
-        }
+              // Fort Road
+            {{4, 15}, {12, 20}},
 
-    }
+             // Engg College Road
+            {{5, 10}, {13, 30}},
 
+             // Khanapur Road
+            {{6, 25}, {14, 35}},
 
+             // Udyambag
+            {{7, 15}, {15, 20}},
 
-void displayCollectedWasteByDate() {
-    // Check if there are any waste collection records
-    if (allocations.empty()) {
-        std::cout << "No waste collection details available.\n";
-        return;
-    }
+              // Bogarves
+            {{8, 20}, {16, 10}},
 
-    std::cout << "=========================================================\n";
-    std::cout << "             Waste Collection Details by Date            \n";
-    std::cout << "=========================================================\n";
+              // Goaves
+            {{9, 30}, {17, 25}},
 
-    // Iterate through each allocation date and its details
-    for (const auto& [date, details] : allocations) {
-        std::cout << "\nDate: " << date << "\n";
-        std::cout << "---------------------------------------------------------\n";
+              // Hindwadi
+            {{10, 35}, {18, 15}},
 
-        // Display all details for a specific date
-        for (const auto& detail : details) {
-            std::cout << "  Vehicle Model    : " << detail.vehicleModel << "\n";
-            std::cout << "  Driver Name      : " << detail.driverName << "\n";
-            std::cout << "  Waste Area       : " << detail.wasteArea << "\n";
-            std::cout << "  Fuel Required    : " << detail.fuelRequired << " liters\n";
-            std::cout << "  Route            : ";
-
-            // Print the route with arrows between areas
-            for (size_t i = 0; i < detail.route.size(); ++i) {
-                std::cout << detail.route[i];
-                if (i != detail.route.size() - 1) {
-                    std::cout << " -> ";
-                }
-            }
-            std::cout << "\n---------------------------------------------------------\n";
-        }
+              // Mache
+            {{11, 20}, {19, 10}},
 
-        std::cout << "\n=========================================================\n";
-    }
+            // Malmaruti
+            {{12, 10}, {20, 30}},
 
-    // Summary or concluding message (optional)
-    std::cout << "End of waste collection records.\n";
-}
+            // Nemgoa
+            {{13, 25}, {21, 15}},
 
-void storeDataInFile()
-{
+            // Shahpur
+            {{14, 15}, {22, 20}},
 
-    // Hardcoded file path
-    std::string filename = "C:\\Users\\mahes\\OneDrive\\Desktop\\route management\\dateDATA.txt";
+            // Sambhaji Nagar
+            {{15, 10}, {23, 25}},
 
-    // Attempt to open the file for writing
-    std::ofstream outFile(filename, std::ios::out | std::ios::app);
-     // Open in append mode
-    if (!outFile)
-      {
-        std::cerr << "Error opening file for writing." << std::endl;
-        return;
-    }
+              // Angol
+            {{16, 30}, {24, 20}},
 
-    // Write the header to the file
-    outFile << "Collected Waste Data by Date:\n";
+             // Balekundri
+            {{17, 15}},
 
-    // Check if there are any allocations
-    if (allocations.empty())
-      {
-        outFile << "No waste collection data available.\n";
-        std::cout << "No data to store in the file.\n";
-        outFile.close(); // Close the file before returning
-        return;
-    }
+              // Camp
+            {{18, 20}},
 
-    // Iterate over all waste collection details by date
-    for (const auto& [date, details] : allocations)
-      {
+              // Dharamnath
+            {{19, 25}},
 
-        outFile << "Date: " << date << "\n";
-        for (const auto& detail : details)
-        {
+                // Fort Lake
+            {{20, 20}}
 
-            outFile << "Vehicle Model: " << detail.vehicleModel
-                    << ", Driver Name: " << detail.driverName
-                    << ", Waste Area: " << detail.wasteArea
-                    << ", Fuel Required: " << detail.fuelRequired << " liters\n";
-            outFile << "Route: ";
+        };
 
-            for (const auto& area : detail.route)
-              {
-                outFile << area << (area == detail.route.back() ? "" : " -> ");
+        std::vector<RoadEdge> roads;
+        for (int u = 0; u < static_cast<int>(graph.size()); u++)
+        {
+            for (const auto& [v, weight] : graph[u])
+            {
+                roads.push_back({u, v, weight});
             }
-            outFile << "\n";
         }
+        setRoadNetwork(defaultAreas, roads);
+
+        // The graph is fixed from here on, so precompute every route once
+        buildAllPairsShortestPaths();
 
-        outFile << " ---------------------------------------------------------\n";
     }
 
-    // Close the file and notify the user
-    outFile.close();
-    std::cout << "Data stored successfully in " << filename << std::endl;
 
-}
+    // Replaces the road network with the given areas and one-way roads
+    // Leaves the current network alone if a road starts or ends outside the given areas
+    bool setRoadNetwork(const std::vector<std::string>& areaNames, const std::vector<RoadEdge>& roads)
+    {
+        int n = areaNames.size();
+        for (const auto& road : roads)
+        {
+            if (road.from < 0 || road.from >= n || road.to < 0 || road.to >= n)
+            {
+                std::cerr << "Error: Road from area " << road.from + 1 << " to area " << road.to + 1 << " is outside the "
+                          << n << " areas.\n";
+                return false;
+            }
+        }
 
-//display the content of file
+        areas = areaNames;
+        areaLatitude.assign(n, std::nan(""));
+        areaLongitude.assign(n, std::nan(""));
 
-void displayFileContent(const std::string& filename)
-{
+        areaIndex.clear();
+        areaIndex.reserve(n);
+        for (int i = 0; i < n; i++)
+        {
+            // First occurrence wins, matching the old linear search
+            areaIndex.emplace(areas[i], i);
+        }
 
-    // Attempt to open the file for reading
-    std::ifstream inFile(filename);
-    if (!inFile)
-      {
-        std::cerr << "Error: Unable to open file '" << filename << "' for reading.\n";
-        return;
-    }
+        // Counting sort of the roads by their starting area
+        edgeOffsets.assign(n + 1, 0);
+        for (const auto& road : roads)
+        {
+            edgeOffsets[road.from + 1]++;
+        }
+        for (int u = 0; u < n; u++)
+        {
+            edgeOffsets[u + 1] += edgeOffsets[u];
+        }
 
-    // Display a header for better clarity
-    std::cout << "=========================================================\n";
-    std::cout << "                 Displaying File Content                 \n";
-    std::cout << "=========================================================\n";
-
-    // Read and display file content line by line
-
-    std::string line;
-    bool isEmpty = true;
-    while (std::getline(inFile, line))
+        edgeTargets.resize(roads.size());
+        edgeWeights.resize(roads.size());
+        std::vector<int> next(edgeOffsets.begin(), edgeOffsets.end() - 1);
+        for (const auto& road : roads)
+        {
+            int slot = next[road.from]++;
+            edgeTargets[slot] = road.to;
+            edgeWeights[slot] = road.weight;
+        }
+        edgeProfile.clear();
 
-      {
-        isEmpty = false;
-        std::cout << line << "\n";
+        resolveWasteAreas();
+        invalidateRoutes();
+        return true;
     }
 
-    // Check if the file was empty
-    if (isEmpty)
-      {
-        std::cout << "The file is empty.\n";
-    }
 
-    // Footer for better output structure
-    std::cout << "=========================================================\n";
-    std::cout << "                  End of File Content                    \n";
-    std::cout << "=========================================================\n";
+    // Loads a road network from a file, replacing the current one
+    // Supports the binary format written by saveRoadNetwork and text edge lists:
+    //   p sp <areas> <roads>      problem line (DIMACS shortest path format)
+    //   a <from> <to> <km>        one-way road, areas numbered from 1
+    //   n <area> <name>           optional area name, otherwise "Area <n>"
+    //   v <area> <lon> <lat>      optional coordinates in millionths of a degree (DIMACS .co)
+    //   c ...                     comment
+    bool loadRoadNetwork(const std::string& filename)
+    {
+        std::ifstream inFile(filename, std::ios::binary);
+        if (!inFile)
+        {
+            std::cerr << "Error: Unable to open road network file '" << filename << "'.\n";
+            return false;
+        }
 
-    // Close the file
-    inFile.close();
+        char magic[4] = {};
+        inFile.read(magic, 4);
+        if (inFile.gcount() == 4 && std::string(magic, 4) == "BWRN")
+        {
+            return loadBinaryRoadNetwork(inFile, filename);
+        }
 
-}
+        inFile.clear();
+        inFile.seekg(0);
 
-//load content of file
-// display allocation record
+        std::vector<std::string> names;
+        std::vector<RoadEdge> roads;
+        std::vector<std::pair<long, std::pair<double, double>>> coordinates;
+        std::string line;
+        int lineNumber = 0;
 
-void loadDataFromFile(const std::string& filename)
- {
-    // Attempt to open the file for reading
-    std::ifstream inFile(filename);
-    if (!inFile)
-      {
-        std::cerr << "Error: Unable to open file '" << filename << "' for reading.\n";
-        return;
+        while (std::getline(inFile, line))
+        {
+            lineNumber++;
+            if (line.empty() || line[0] == 'c' || line[0] == '\r')
+            {
+                continue;
+            }
 
-    }
+            const char* text = line.c_str() + 1;
+            char* end = nullptr;
 
-    // Display a header for better clarity
-    std::cout << "=========================================================\n";
-    std::cout << "                 Displaying File Content                 \n";
-    std::cout << "=========================================================\n";
+            if (line[0] == 'p')
+            {
+                // "p sp <areas> <roads>"
+                std::size_t countsAt = line.find_first_of("0123456789");
+                if (countsAt == std::string::npos)
+                {
+                    std::cerr << "Error: Malformed problem line " << lineNumber << " in '" << filename << "'.\n";
+                    return false;
+                }
+                text = line.c_str() + countsAt;
+                long n = std::strtol(text, &end, 10);
+                const char* countEnd = end;
+                long m = std::strtol(countEnd, &end, 10);
+                // Areas already used by earlier lines must stay, so the count may not be smaller
+                if (end == countEnd || n < 0 || n > TEXT_AREA_LIMIT || m < 0 || m > TEXT_ROAD_LIMIT ||
+                    static_cast<std::size_t>(n) < names.size())
+                {
+                    std::cerr << "Error: Malformed problem line " << lineNumber << " in '" << filename << "'.\n";
+                    return false;
+                }
+                names.resize(n);
+                roads.reserve(m);
+            }
+            else if (line[0] == 'a')
+            {
+                long from = std::strtol(text, &end, 10);
+                long to = std::strtol(end, &end, 10);
+                const char* weightAt = end;
+                long weight = std::strtol(weightAt, &end, 10);
+                if (end == weightAt || from < 1 || from > TEXT_AREA_LIMIT || to < 1 || to > TEXT_AREA_LIMIT || weight < 0 ||
+                    weight > std::numeric_limits<int>::max() || roads.size() >= static_cast<std::size_t>(TEXT_ROAD_LIMIT))
+                {
+                    std::cerr << "Error: Malformed road on line " << lineNumber << " in '" << filename << "'.\n";
+                    return false;
+                }
+                if (static_cast<std::size_t>(std::max(from, to)) > names.size())
+                {
+                    names.resize(std::max(from, to));
+                }
+                roads.push_back({static_cast<int>(from - 1), static_cast<int>(to - 1), static_cast<int>(weight)});
+            }
+            else if (line[0] == 'n')
+            {
+                long id = std::strtol(text, &end, 10);
+                if (id < 1 || id > TEXT_AREA_LIMIT)
+                {
+                    std::cerr << "Error: Malformed area name on line " << lineNumber << " in '" << filename << "'.\n";
+                    return false;
+                }
+                while (*end == ' ' || *end == '\t') end++;
+                std::string name(end);
+                if (!name.empty() && name.back() == '\r') name.pop_back();
+                if (static_cast<std::size_t>(id) > names.size())
+                {
+                    names.resize(id);
+                }
+                names[id - 1] = name;
+            }
+            else if (line[0] == 'v')
+            {
+                long id = std::strtol(text, &end, 10);
+                double longitude = std::strtod(end, &end) / 1e6;
+                double latitude = std::strtod(end, &end) / 1e6;
+                if (id < 1 || id > TEXT_AREA_LIMIT)
+                {
+                    std::cerr << "Error: Malformed coordinates on line " << lineNumber << " in '" << filename << "'.\n";
+                    return false;
+                }
+                if (static_cast<std::size_t>(id) > names.size())
+                {
+                    names.resize(id);
+                }
+                coordinates.push_back({id - 1, {latitude, longitude}});
+            }
+            else
+            {
+                std::cerr << "Error: Unknown line " << lineNumber << " in '" << filename << "'.\n";
+                return false;
+            }
+        }
 
-    // Read and display file content line by line
-    std::string line;
-    bool isEmpty = true;
-    while (std::getline(inFile, line))
-      {
+        for (std::size_t i = 0; i < names.size(); i++)
+        {
+            if (names[i].empty())
+            {
+                names[i] = "Area " + std::to_string(i + 1);
+            }
+        }
 
-        isEmpty = false;
-        std::cout << line << "\n";
+        if (!setRoadNetwork(names, roads))
+        {
+            return false;
+        }
+        for (const auto& [area, position] : coordinates)
+        {
+            setAreaCoordinates(area, position.first, position.second);
+        }
+        std::cout << "Loaded " << areas.size() << " areas and " << edgeTargets.size() << " roads from '" << filename << "'.\n";
+        return true;
     }
 
-    // Check if the file was empty
-    if (isEmpty)
-      {
 
-        std::cout << "The file is empty.\n";
-    }
+    // Writes the road network in binary form: "BWRN", area count, road count,
+    // the CSR arrays, each area name as a length followed by its characters, and
+    // finally the latitudes and longitudes (older files simply end after the names)
+    bool saveRoadNetwork(const std::string& filename) const
+    {
+        std::ofstream outFile(filename, std::ios::binary | std::ios::trunc);
+        if (!outFile)
+        {
+            std::cerr << "Error: Unable to open road network file '" << filename << "' for writing.\n";
+            return false;
+        }
 
-    // Footer for better output structure
-    std::cout << "=========================================================\n";
-    std::cout << "                  End of File Content                    \n";
-    std::cout << "=========================================================\n";
+        std::int32_t n = areas.size();
+        std::int32_t m = edgeTargets.size();
+        outFile.write("BWRN", 4);
+        outFile.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        outFile.write(reinterpret_cast<const char*>(&m), sizeof(m));
+        outFile.write(reinterpret_cast<const char*>(edgeOffsets.data()), (n + 1) * sizeof(int));
+        outFile.write(reinterpret_cast<const char*>(edgeTargets.data()), m * sizeof(int));
+        outFile.write(reinterpret_cast<const char*>(edgeWeights.data()), m * sizeof(int));
 
-    // Close the file
-    inFile.close();
+        for (const auto& name : areas)
+        {
+            std::int32_t length = name.size();
+            outFile.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            outFile.write(name.data(), length);
+        }
 
-}
+        outFile.write(reinterpret_cast<const char*>(areaLatitude.data()), n * sizeof(double));
+        outFile.write(reinterpret_cast<const char*>(areaLongitude.data()), n * sizeof(double));
 
-// diplay Menu
-    void displayMenu()
-     {
+        return static_cast<bool>(outFile);
+    }
 
-        std::cout << " --------------------------------------------------------------------------------------------------------" << std::endl;
-        std::cout << "    " << std::endl;
-        std::cout << "Belgaum City Waste Management System" << std::endl;
-        std::cout << "1. Allot Vehicle" << std::endl;
-        std::cout << "2. Display Vehicles" << std::endl;
-        std::cout << "3. Display Drivers" << std::endl;
-        std::cout << "4. Display Wastes" << std::endl;
-        std::cout << "5. Shortest Route Details" << std::endl;
-        std::cout << "6. Longest Route Details" << std::endl;
-        std::cout << "7. View Available Vehicles and Drivers" << std::endl;
-        std::cout << "8. Display Collected Waste by Date" << std::endl;
-        std::cout << "9. Save Collected Waste Data to File" << std::endl;
-        std::cout << "10. Load Data from File" << std::endl;
-        std::cout << "11. Exit" << std::endl;
-        std::cout << " ---------------------------------------------------------------------------------------------------------" << std::endl;
 
+    // Reads the body of a binary road network file (after the "BWRN" magic)
+    bool loadBinaryRoadNetwork(std::ifstream& inFile, const std::string& filename)
+    {
+        auto corrupt = [&filename]() {
+            std::cerr << "Error: Corrupt road network file '" << filename << "'.\n";
+            return false;
+        };
 
-    }
+        std::int32_t n = 0, m = 0;
+        inFile.read(reinterpret_cast<char*>(&n), sizeof(n));
+        inFile.read(reinterpret_cast<char*>(&m), sizeof(m));
+        if (!inFile || n < 0 || m < 0)
+        {
+            return corrupt();
+        }
 
+        // The counts are checked against the bytes left before anything is allocated: the
+        // CSR arrays and a length for every name must fit
+        std::streamoff start = inFile.tellg();
+        inFile.seekg(0, std::ios::end);
+        std::int64_t left = static_cast<std::int64_t>(inFile.tellg() - start);
+        inFile.seekg(start);
+        std::int64_t arrayBytes = (static_cast<std::int64_t>(n) + 1 + 2 * static_cast<std::int64_t>(m)) * static_cast<std::int64_t>(sizeof(int));
+        if (!inFile || arrayBytes + static_cast<std::int64_t>(n) * static_cast<std::int64_t>(sizeof(std::int32_t)) > left)
+        {
+            return corrupt();
+        }
+        left -= arrayBytes;
 
-void viewAvailableVehiclesAndDrivers()
-{
+        std::vector<int> offsets(n + 1), targets(m), weights(m);
+        inFile.read(reinterpret_cast<char*>(offsets.data()), (n + 1) * sizeof(int));
+        inFile.read(reinterpret_cast<char*>(targets.data()), m * sizeof(int));
+        inFile.read(reinterpret_cast<char*>(weights.data()), m * sizeof(int));
 
-    // Display header for available vehicles
-    std::cout << "=========================================================\n";
-    std::cout << "                   Available Vehicles                   \n";
-    std::cout << "=========================================================\n";
+        std::vector<std::string> names(n);
+        for (auto& name : names)
+        {
+            std::int32_t length = 0;
+            inFile.read(reinterpret_cast<char*>(&length), sizeof(length));
+            left -= sizeof(length);
+            if (!inFile || length < 0 || length > left)
+            {
+                return corrupt();
+            }
+            name.resize(length);
+            inFile.read(&name[0], length);
+            left -= length;
+        }
 
-    bool foundAvailableVehicle = false;
-    for (size_t i = 0; i < vehicles.size(); i++)
-      {
+        // Every road must stay inside the arrays: offsets from 0 to m that never decrease,
+        // targets that are areas, and no negative lengths (which the text format rejects too)
+        if (!inFile || offsets[0] != 0 || offsets[n] != m)
+        {
+            return corrupt();
+        }
+        for (int i = 0; i < n; i++)
+        {
+            if (offsets[i] > offsets[i + 1])
+            {
+                return corrupt();
+            }
+        }
+        for (int e = 0; e < m; e++)
+        {
+            if (targets[e] < 0 || targets[e] >= n || weights[e] < 0)
+            {
+                return corrupt();
+            }
+        }
 
-        if (!vehicles[i].isAllotted)
+        std::vector<double> latitude(n, std::nan("")), longitude(n, std::nan(""));
+        if (inFile.peek() != std::ifstream::traits_type::eof())
         {
-            std::cout << "Vehicle Model: " << vehicles[i].vehicleModel << "\n"
-                      << "  Load Capacity: " << vehicles[i].loadCapacity << " kg\n"
-                      << "  Mileage: " << vehicles[i].mileage << " km/l\n";
-            std::cout << "---------------------------------------------------------\n";
-            foundAvailableVehicle = true;
+            inFile.read(reinterpret_cast<char*>(latitude.data()), n * sizeof(double));
+            inFile.read(reinterpret_cast<char*>(longitude.data()), n * sizeof(double));
+            if (!inFile)
+            {
+                return corrupt();
+            }
         }
-    }
 
-    if (!foundAvailableVehicle)
-      {
-        std::cout << "No available vehicles at the moment.\n";
-    }
+        areas = std::move(names);
+        areaLatitude = std::move(latitude);
+        areaLongitude = std::move(longitude);
+        heuristicVersion = -1;
+        areaIndex.clear();
+        areaIndex.reserve(n);
+        for (int i = 0; i < n; i++)
+        {
+            areaIndex.emplace(areas[i], i);
+        }
+        edgeOffsets = std::move(offsets);
+        edgeTargets = std::move(targets);
+        edgeWeights = std::move(weights);
+        edgeProfile.clear();
+        resolveWasteAreas();
+        invalidateRoutes();
 
-    // Display header for available drivers
-    std::cout << "\n=========================================================\n";
-    std::cout << "                   Available Drivers                    \n";
-    std::cout << "=========================================================\n";
+        std::cout << "Loaded " << n << " areas and " << m << " roads from '" << filename << "'.\n";
+        return true;
+    }
 
+    // Function to get the index of an area
+    int getAreaIndex(const std::string& areaName)
+     {
 
-    bool foundAvailableDriver = false;
-    for (size_t i = 0; i < drivers.size(); i++)
-      {
-        if (!drivers[i].isAllotted)
+        auto it = areaIndex.find(areaName);
+        if (it != areaIndex.end())
           {
-
-            std::cout << "Driver Name: " << drivers[i].name << "\n"
-                      << "  Age: " << drivers[i].age << "\n"
-                      << "  Address: " << drivers[i].address << "\n";
-            std::cout << "---------------------------------------------------------\n";
-            foundAvailableDriver = true;
+            return it->second;
         }
+        // Return -1 if area is not found
+        return -1;
     }
 
-    if (!foundAvailableDriver)
-      {
 
-        std::cout << "No available drivers at the moment.\n";
+    // Sets an area's position (degrees), used by A* route queries
+    bool setAreaCoordinates(int area, double latitude, double longitude)
+    {
+        if (area < 0 || area >= static_cast<int>(areas.size()))
+            return false;
+
+        areaLatitude[area] = latitude;
+        areaLongitude[area] = longitude;
+        heuristicVersion = -1;
+        return true;
     }
 
-    // Footer for better structure
-    std::cout << "=========================================================\n";
-    std::cout << "                  End of Availability                   \n";
-    std::cout << "=========================================================\n";
 
-}
+    // Algorithm used for point-to-point queries on networks too large for the all-pairs table
+    void setRouteAlgorithm(RouteAlgorithm algorithm)
+    {
+        routeAlgorithm = algorithm;
+    }
 
-void displayVehicles()
-{
 
-    // Display header for the vehicles section
-    std::cout << "=========================================================\n";
-    std::cout << "                    List of Vehicles                    \n";
-    std::cout << "=========================================================\n";
+    // Number of areas (graph nodes) known to the system
+    int getAreaCount() const
+    {
+        return static_cast<int>(areas.size());
+    }
 
-    if (vehicles.empty())
-      {
 
-        std::cout << "No vehicles available in the system.\n";
+    // Number of waste piles registered so far
+    int getWasteCount() const
+    {
+        return static_cast<int>(wastes.size());
     }
-    else
-      {
 
-        for (int i = 0; i < vehicles.size(); i++)
 
-        {
-            std::cout << "---------------------------------------------------------\n";
-            std::cout << "Vehicle " << i + 1 << ":\n";
-            std::cout << "  Model: " << vehicles[i].vehicleModel << "\n"
-                      << "  Load Capacity: " << vehicles[i].loadCapacity << " kg\n"
-                      << "  Mileage: " << vehicles[i].mileage << " km/l\n"
-                      << "  Allotted: " << (vehicles[i].isAllotted ? "Yes" : "No") << "\n";
-            std::cout << "---------------------------------------------------------\n";
-        }
+    // Add Vehicle
+    void addVehicle(Vehicle v)
+    {
+        vehicles.push_back(v);
+        if (!v.isAllotted)
+            freeVehicles.insert({v.loadCapacity, static_cast<int>(vehicles.size()) - 1});
+    }
 
+
+    // Add Driver
+    void addDriver(Driver d)
+    {
+
+        drivers.push_back(d);
+        if (!d.isAllotted)
+            freeDrivers.insert(static_cast<int>(drivers.size()) - 1);
     }
 
-    // Display footer for the vehicles section
-    std::cout << "=========================================================\n";
-    std::cout << "                  End of Vehicle List                   \n";
-    std::cout << "=========================================================\n";
-}
 
+    // Take the free vehicle with the smallest capacity that still holds requiredCapacity
+    // Returns its index, or -1 if no free vehicle is large enough
+    int takeBestFitVehicle(int requiredCapacity)
+    {
+        auto it = freeVehicles.lower_bound({requiredCapacity, -1});
+        if (it == freeVehicles.end())
+            return -1;
 
-void displayDrivers()
-{
-    // Display header for the drivers section
-    std::cout << "=========================================================\n";
-    std::cout << "                    List of Drivers                     \n";
-    std::cout << "=========================================================\n";
+        int index = it->second;
+        freeVehicles.erase(it);
+        vehicles[index].isAllotted = true;
+        return index;
+    }
 
-    if (drivers.empty())
-      {
 
-        std::cout << "No drivers available in the system.\n";
+    // Take the next available driver, or -1 if every driver is on a route
+    int takeDriver()
+    {
+        if (freeDrivers.empty())
+            return -1;
+
+        int index = *freeDrivers.begin();
+        freeDrivers.erase(freeDrivers.begin());
+        drivers[index].isAllotted = true;
+        return index;
     }
-    else
-      {
-        for (int i = 0; i < drivers.size(); i++)
-         {
-            std::cout << "---------------------------------------------------------\n";
-            std::cout << "Driver " << i + 1 << ":\n";
-            std::cout << "  Name: " << drivers[i].name << "\n"
-                      << "  Age: " << drivers[i].age << " years\n"
-                      << "  Address: " << drivers[i].address << "\n";
-            std::cout << "---------------------------------------------------------\n";
-        }
-
-    }
-
-    // Display footer for the drivers section
-    std::cout << "=========================================================\n";
-    std::cout << "                  End of Driver List                    \n";
-    std::cout << "=========================================================\n";
-
-}
-
-void displayWastes()
-{
-
-    // Display header for the wastes section
-    std::cout << "=========================================================\n";
-    std::cout << "                    Waste Information                    \n";
-    std::cout << "=========================================================\n";
 
-    if (wastes.empty())
-      {
 
-        std::cout << "No waste data available.\n";
-    }
-    else
-      {
-        for (int i = 0; i < wastes.size(); i++)
-          {
-            std::cout << "---------------------------------------------------------\n";
-            std::cout << "Waste " << i + 1 << ":\n";
-            std::cout << "  Area: " << wastes[i].area << "\n"
-                      << "  Quantity: " << wastes[i].quantity << " kg\n";
-            std::cout << "---------------------------------------------------------\n";
-        }
+    // Put a vehicle back into the free pool once its trip is over
+    bool releaseVehicle(int index)
+    {
+        if (index < 0 || index >= static_cast<int>(vehicles.size()) || !vehicles[index].isAllotted)
+            return false;
 
+        vehicles[index].isAllotted = false;
+        freeVehicles.insert({vehicles[index].loadCapacity, index});
+        return true;
     }
 
-    // Display footer for the wastes section
-    std::cout << "=========================================================\n";
-    std::cout << "                   End of Waste List                    \n";
-    std::cout << "=========================================================\n";
-}
 
+    // Put a driver back into the free pool once the trip is over
+    bool releaseDriver(int index)
+    {
+        if (index < 0 || index >= static_cast<int>(drivers.size()) || !drivers[index].isAllotted)
+            return false;
 
-void findLongestRouteToDestination(int source, int destination)
-{
+        drivers[index].isAllotted = false;
+        freeDrivers.insert(index);
+        return true;
+    }
 
-    // Vector to store parent nodes and distances from the source node
 
-    std::vector<int> parent;
-    std::vector<int> dist;
+    // Add waste
+    void addWaste(Waste w)
+     {
+        // Resolve the area name here so allotment never compares strings
+        w.areaId = getAreaIndex(w.area);
+        wastes.push_back(w);
+    }
 
-    // Call findLongestPath to compute the longest path from the source
 
-    findLongestPath(source, dist, parent);
+    // Re-resolve waste areas after the road network has been replaced
+    void resolveWasteAreas()
+    {
+        for (auto& waste : wastes)
+        {
+            waste.areaId = getAreaIndex(waste.area);
+        }
+    }
 
-    // Check if the destination is reachable from the source
-    if (dist[destination] == std::numeric_limits<int>::min())
-      {
 
-        std::cout << "No path exists from " << areas[source] << " to " << areas[destination] << "." << std::endl;
-        return;
+    // Area names in index order
+    const std::vector<std::string>& getAreas() const
+    {
+        return areas;
     }
 
-    // Display the longest distance to the destination
-    std::cout << "Longest distance to " << areas[destination] << ": " << dist[destination] << " km" << std::endl;
 
-    // Reconstruct and display the longest path
+    // Assuming constant speed in km/h for simplicity (40 km/h)
+    // average
 
-}
+    const double VEHICLE_SPEED = 40.0;
 
- // Existing code...
 
-    // to simulate vehicle maintenance
-    void performVehicleMaintenance()
+    // Function to calculate travel time (in hours) based on distance and speed
+    double calculateTravelTime(double distance)
     {
-        // Placeholder for maintenance logic
+        return distance / VEHICLE_SPEED;
     }
 
-    //  to simulate driver training
-    void conductDriverTraining()
-    {
-        // Placeholder for training logic
-    }
 
-    //  to simulate waste segregation
-    void segregateWaste()
+    // Time in hours to drive path leaving at departureMinute (minutes since midnight),
+    // following each road's speed profile; of parallel roads the quickest is taken
+    double calculateTravelTime(const std::vector<int>& path, double departureMinute) const
     {
-        // Placeholder for waste segregation logic
+        double t = departureMinute;
+        for (size_t k = 0; k + 1 < path.size(); k++)
+        {
+            double best = std::numeric_limits<double>::infinity();
+            for (int e = edgeOffsets[path[k]]; e < edgeOffsets[path[k] + 1]; e++)
+            {
+                if (edgeTargets[e] == path[k + 1])
+                    best = std::min(best, roadTravelMinutes(e, t));
+            }
+            if (best < std::numeric_limits<double>::infinity())
+                t += best;
+        }
+        return (t - departureMinute) / 60;
     }
 
-    //  simulate fuel efficiency calculation
-    void calculateFuelEfficiency()
+
+    // Minutes to drive road e when entering it at minute t
+    double roadTravelMinutes(int e, double t) const
     {
-        // Placeholder for fuel efficiency calculation logic
+        const SpeedProfile& profile = speedProfiles[edgeProfile.empty() ? 0 : edgeProfile[e]];
+        return profile.travelMinutes(edgeWeights[e], t);
     }
 
-    // to simulate route optimization
-    void optimizeRoutes()
+
+    // Index of the named speed profile, or -1
+    int findSpeedProfile(const std::string& name) const
     {
-        // Placeholder for route optimization logic
+        for (size_t i = 0; i < speedProfiles.size(); i++)
+        {
+            if (speedProfiles[i].name == name)
+                return static_cast<int>(i);
+        }
+        return -1;
     }
 
-    // to simulate waste disposal reporting
-    void generateWasteDisposalReport()
+
+    // Defines (or redefines) a speed profile from (minute of day, km/h) breakpoints
+    // Minutes must be increasing within [0, 1440) and every speed positive
+    bool setSpeedProfile(const std::string& name, std::vector<std::pair<double, double>> points)
     {
-        // Placeholder for report generation logic
+        std::sort(points.begin(), points.end());
+        if (points.empty() || name == "flat")
+            return false;
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            if (points[i].first < 0 || points[i].first >= 1440 || points[i].second <= 0 ||
+                (i > 0 && points[i].first == points[i - 1].first))
+                return false;
+        }
+
+        int index = findSpeedProfile(name);
+        if (index == -1)
+        {
+            // Roads store the profile index in one byte
+            if (speedProfiles.size() > std::numeric_limits<std::uint8_t>::max())
+                return false;
+            speedProfiles.push_back({name, std::move(points)});
+        }
+        else
+        {
+            speedProfiles[index].points = std::move(points);
+        }
+        return true;
     }
 
-    //  to simulate emergency response
-    void handleEmergencySituation()
+
+    // Gives every road from -> to (or every road when from is -1) the named profile
+    bool setRoadProfile(int from, int to, const std::string& name)
     {
-        // Placeholder for emergency handling logic
+        int profile = findSpeedProfile(name);
+        int n = areas.size();
+        if (profile == -1 || from < -1 || from >= n || to < -1 || to >= n || (from == -1) != (to == -1))
+            return false;
+
+        if (edgeProfile.empty())
+            edgeProfile.assign(edgeTargets.size(), 0);
+
+        bool found = false;
+        for (int u = (from == -1 ? 0 : from); u < (from == -1 ? n : from + 1); u++)
+        {
+            for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+            {
+                if (from == -1 || edgeTargets[e] == to)
+                {
+                    edgeProfile[e] = profile;
+                    found = true;
+                }
+            }
+        }
+        return found;
     }
 
-    //  to simulate vehicle tracking
-    void trackVehicles()
+
+    // Minute of the day (0 - 1439) vehicles leave for allotted trips
+    bool setDispatchTime(double minute)
     {
-        // Placeholder for vehicle tracking logic
+        if (minute < 0 || minute >= 1440)
+            return false;
+        dispatchMinute = minute;
+        return true;
     }
 
-    // to simulate driver feedback collection
-    void collectDriverFeedback()
+
+    // Time-dependent Dijkstra: earliest arrival at destination leaving source at
+    // departureMinute, labels being arrival times rather than distances. Correct because
+    // every profile is FIFO. Returns the route (empty if unreachable)
+    std::vector<int> timeDependentRoute(int source, int destination, double departureMinute, double& arrivalMinute) const
     {
-        // Placeholder for feedback collection logic
+        int n = areas.size();
+        std::vector<double> arrival(n, std::numeric_limits<double>::infinity());
+        std::vector<int> parent(n, -1);
+        arrival[source] = departureMinute;
+
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> pq;
+        pq.push({departureMinute, source});
+        while (!pq.empty())
+        {
+            auto [t, node] = pq.top();
+            pq.pop();
+            if (t > arrival[node]) continue;
+            if (node == destination) break;
+
+            for (int e = edgeOffsets[node]; e < edgeOffsets[node + 1]; e++)
+            {
+                int neighbor = edgeTargets[e];
+                double reached = t + roadTravelMinutes(e, t);
+                if (reached < arrival[neighbor])
+                {
+                    arrival[neighbor] = reached;
+                    parent[neighbor] = node;
+                    pq.push({reached, neighbor});
+                }
+            }
+        }
+
+        std::vector<int> path;
+        arrivalMinute = arrival[destination];
+        if (arrivalMinute == std::numeric_limits<double>::infinity())
+            return path;
+
+        for (int at = destination; at != -1; at = parent[at])
+        {
+            path.push_back(at);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
     }
 
-    // to simulate waste collection scheduling
-    void scheduleWasteCollection()
+
+    // Quickest route leaving source at departureMinute, with its arrival time
+    void findFastestRouteToDestination(int source, int destination, double departureMinute)
     {
-        // Placeholder for scheduling logic
+        double arrivalMinute = 0;
+        std::vector<int> path = timeDependentRoute(source, destination, departureMinute, arrivalMinute);
+        if (path.empty())
+        {
+            std::cout << "No path exists from " << areas[source] << " to " << areas[destination] << "." << std::endl;
+            return;
+        }
+
+        // Replay the route to add up the roads actually taken (the quickest of any parallel roads)
+        long long distance = 0;
+        double at = departureMinute;
+        std::cout << "Fastest route to " << areas[destination] << " leaving at " << formatClockTime(departureMinute) << ": ";
+        for (size_t k = 0; k < path.size(); k++)
+        {
+            std::cout << areas[path[k]] << (k + 1 < path.size() ? " -> " : "");
+            if (k + 1 == path.size())
+                break;
+
+            int taken = -1;
+            double best = std::numeric_limits<double>::infinity();
+            for (int e = edgeOffsets[path[k]]; e < edgeOffsets[path[k] + 1]; e++)
+            {
+                if (edgeTargets[e] == path[k + 1] && roadTravelMinutes(e, at) < best)
+                {
+                    best = roadTravelMinutes(e, at);
+                    taken = e;
+                }
+            }
+            distance += edgeWeights[taken];
+            at += best;
+        }
+        std::cout << std::endl;
+
+        double minutes = arrivalMinute - departureMinute;
+        std::cout << "Total Distance: " << distance << " km\n";
+        std::cout << "Arrives at " << formatClockTime(arrivalMinute) << " after " << static_cast<int>(minutes / 60)
+                  << " hours and " << static_cast<int>(std::fmod(minutes, 60)) << " minutes." << std::endl;
     }
 
-    // all remaining functions
 
-//calculate shortest route
-// use of dijkastra algorithm
-void findShortestRouteToDestination(int source, int destination)
+// Dijkstra's Algorithm for finding the shortest path from a source to a destination in a weighted graph
+std::vector<int> dijkstra(int source, int destination, std::vector<int>& parent)
 {
-    std::vector<int> parent;
 
-    // Compute the shortest distances and parent paths using Dijkstra's algorithm
-    auto distances = dijkstra(source, destination, parent);
+    // Initialize the number of nodes in the graph
+    int n = areas.size();
 
-    // Check if the destination is reachable from the source
-    if (distances[destination] == std::numeric_limits<int>::max())
-      {
+    // Initialize distance vector with maximum possible values (infinity) to indicate that initially all nodes are unreachable
+    std::vector<int> distance(n, std::numeric_limits<int>::max());
 
-        std::cout << "No path exists from " << areas[source] << " to " << areas[destination] << "." << std::endl;
-        return;
-    }
+    // Initialize the parent vector to store the path information
+    parent.assign(n, -1);
 
-    // Display the shortest distance to the destination
-    std::cout << "Shortest distance to " << areas[destination] << ": " << distances[destination] << " km" << std::endl;
+    // Distance to the source itself is always 0
+    distance[source] = 0;
 
-    // Display the shortest route from source to destination
-    std::cout << "Route: ";
-    std::stack<int> path;
-    for (int at = destination; at != -1; at = parent[at])
-      {
-        path.push(at);
-    }
+    // Min-heap priority queue to select the node with the smallest distance
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>> pq;
+    pq.push({0, source});
+
+    // Continue until all nodes processed or priority queue is empty
+    while (!pq.empty())
 
-    // Output the path from source to destination in human-readable format
-    while (!path.empty())
     {
+        // Extract the node with the smallest distance
+        auto [dist, node] = pq.top();
+        pq.pop();
 
-        std::cout << areas[path.top()] << (path.size() > 1 ? " -> " : "");
-        path.pop();
-    }
+        // If the current distance is greater than the recorded distance, skip processing
+        if (dist > distance[node]) continue;
 
-    std::cout << std::endl;
+        // Explore all the neighbors of the current node
+        for (int e = edgeOffsets[node]; e < edgeOffsets[node + 1]; e++)
+        {
+            int neighbor = edgeTargets[e];
+            int weight = edgeWeights[e];
 
-    // Calculate and display additional travel information
-    //in hr and min
-    double totalDistance = distances[destination];
-    double travelTime = calculateTravelTime(totalDistance);
+            // Calculate new distance for the neighbor
+            int newDist = distance[node] + weight;
 
-    // Extract hours and minutes from the travel time
-    int hours = static_cast<int>(travelTime);
-    int minutes = static_cast<int>((travelTime - hours) * 60);
+            // If the new distance is shorter, update the distance and parent
+            if (newDist < distance[neighbor])
+            {
+                distance[neighbor] = newDist;
+                parent[neighbor] = node;
 
-    // Display the travel time and other relevant information
-    std::cout << " =========================================================" << std::endl;
-    std::cout << "Total Distance: " << totalDistance << " km\n";
+                // Push the updated distance and neighbor node into the priority queue
+                pq.push({newDist, neighbor});
+            }
 
-    // Display the estimated travel time in hours and minutes
-    std::cout << "Estimated Travel Time: " << hours << " hours and " << minutes << " minutes." << std::endl;
+        }
 
-    // Additional informative output for the user
-    std::cout << "\nPlease ensure the vehicle is ready for travel and has sufficient fuel." << std::endl;
-    std::cout << "Remember to check the weather and road conditions before starting the journey." << std::endl;
+    }
 
-    // Conclusion message
-    std::cout << " =========================================================" << std::endl;
+    // Check if the destination is reachable
+    if (distance[destination] == std::numeric_limits<int>::max())
+    {
+        std::cout << "No path exists from " << areas[source] << " to " << areas[destination] << "." << std::endl;
+        return {};
+    }
 
+    // Return the distance vector containing shortest distances from the source to all nodes
+    return distance;
 }
 
-};
 
+// Floyd-Warshall over the whole graph, storing the next hop so any route can be
+// rebuilt in O(path length) without re-running Dijkstra
+void buildAllPairsShortestPaths()
+{
+    const int INF = std::numeric_limits<int>::max();
+    int n = areas.size();
 
-int route()
+    allPairsVersion = graphVersion;
+    if (n > ALL_PAIRS_LIMIT)
+    {
+        // Too large for an n x n table; shortestPath falls back to Dijkstra
+        allPairsDistance.clear();
+        allPairsNext.clear();
+        return;
+    }
 
-{
-    BelgaumWasteManagement bwm;
+    allPairsDistance.assign(n, std::vector<int>(n, INF));
+    allPairsNext.assign(n, std::vector<int>(n, -1));
 
-    // Add Vehicles
-    //vehicle1
-    bwm.addVehicle(Vehicle("Tata Ace", 1000, 13.0));
-    //vehicle2
-    bwm.addVehicle(Vehicle("Mahindra Pickup", 2000, 12.0));
-    //vehicle3
-    bwm.addVehicle(Vehicle("Ashok Leyland Dost", 3000, 14.0));
-    //vehicle4
-    bwm.addVehicle(Vehicle("BharatBenz 1160", 4000, 11.0));
-    //vehicle5
-    bwm.addVehicle(Vehicle("Eicher 950", 6000, 12.0));
-    //vehicle6
-    bwm.addVehicle(Vehicle("Tata Ace Hybrid", 9000, 11.0));
-    //vehicle7
-    bwm.addVehicle(Vehicle("Tata Force", 10000, 10.0));
-    //vehicle8
-    bwm.addVehicle(Vehicle("Leyland Bada Dost", 11000, 9.0));
-    //vehicle9
-    bwm.addVehicle(Vehicle("MAN 1600", 12000, 8.0));
-    //vehicle10
-    bwm.addVehicle(Vehicle("Tata 1630", 14000, 7.0));
-    //All vehicle
+    for (int u = 0; u < n; u++)
+    {
+        allPairsDistance[u][u] = 0;
+        allPairsNext[u][u] = u;
 
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            int v = edgeTargets[e];
+            int weight = edgeWeights[e];
+            // Keep the shorter road if two roads join the same areas
+            if (weight < allPairsDistance[u][v])
+            {
+                allPairsDistance[u][v] = weight;
+                allPairsNext[u][v] = v;
+            }
+        }
+    }
 
-    // Add Drivers
+    for (int k = 0; k < n; k++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (allPairsDistance[i][k] == INF) continue;
 
+            for (int j = 0; j < n; j++)
+            {
+                if (allPairsDistance[k][j] == INF) continue;
 
+                int throughK = allPairsDistance[i][k] + allPairsDistance[k][j];
+                if (throughK < allPairsDistance[i][j])
+                {
+                    allPairsDistance[i][j] = throughK;
+                    allPairsNext[i][j] = allPairsNext[i][k];
+                }
+            }
+        }
+    }
+}
 
-    // All drivers
 
-    bwm.addDriver(Driver("Abhi", 30, "Gokak"));
-    bwm.addDriver(Driver("Arun", 32, "Hubli"));
-    bwm.addDriver(Driver("Akash", 25, "Kanabargi"));
-    bwm.addDriver(Driver("Gagan", 28, "Sambre"));
-    bwm.addDriver(Driver("Venki", 26, "Suldal"));
+// Marks every cached route as stale; call after any change to the road network
+void invalidateRoutes()
+{
+    graphVersion++;
+}
 
-    // Add Wastes
-    //wastearea1
-    bwm.addWaste(Waste("Kanabargi", 500));
 
-    //wastearea2
-    bwm.addWaste(Waste("BelgaumCBT", 1000));
+// Every one-way road in the network
+std::vector<RoadEdge> getRoads() const
+{
+    std::vector<RoadEdge> roads;
+    roads.reserve(edgeTargets.size());
+    for (int u = 0; u < static_cast<int>(areas.size()); u++)
+    {
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            roads.push_back({u, edgeTargets[e], edgeWeights[e]});
+        }
+    }
+    return roads;
+}
 
 
-    //wastearea3
-    bwm.addWaste(Waste("Shivaji Nagar", 1500));
-    //wastearea4
-    bwm.addWaste(Waste("Tilakwadi", 2000));
+// Length of the shortest road from -> to, or INT_MAX when there is none
+int directRoadWeight(int from, int to) const
+{
+    int best = std::numeric_limits<int>::max();
+    for (int e = edgeOffsets[from]; e < edgeOffsets[from + 1]; e++)
+    {
+        if (edgeTargets[e] == to)
+            best = std::min(best, edgeWeights[e]);
+    }
+    return best;
+}
 
-    //wastearea5
-    bwm.addWaste(Waste("Chennamma Nagar", 2500));
 
-    //wastearea6
-    bwm.addWaste(Waste("Gandhinagar", 3000));
+// Opens a new one-way road (another road between the same areas may already exist)
+bool addRoad(int from, int to, int weight)
+{
+    int n = areas.size();
+    if (from < 0 || from >= n || to < 0 || to >= n || from == to || weight < 0)
+        return false;
 
-    //wastearea7
-    bwm.addWaste(Waste("APMC Yard", 3500));
+    int before = directRoadWeight(from, to);
+    int slot = edgeOffsets[from + 1];
+    edgeTargets.insert(edgeTargets.begin() + slot, to);
+    edgeWeights.insert(edgeWeights.begin() + slot, weight);
+    if (!edgeProfile.empty())
+        edgeProfile.insert(edgeProfile.begin() + slot, 0);
+    for (int u = from + 1; u <= n; u++)
+    {
+        edgeOffsets[u]++;
+    }
 
-    //wastearea8
-    bwm.addWaste(Waste("City Market", 4000));
+    roadChanged(from, to, before);
+    return true;
+}
 
-    //wastearea9
-    bwm.addWaste(Waste("Fort Road", 4500));
 
-    //wastearea10
-    bwm.addWaste(Waste("Engg College Road", 5000));
+// Closes every road from -> to
+bool removeRoad(int from, int to)
+{
+    int n = areas.size();
+    if (from < 0 || from >= n || to < 0 || to >= n)
+        return false;
 
-    //wastearea11
-    bwm.addWaste(Waste("Khanapur Road", 5500));
+    int before = directRoadWeight(from, to);
+    int kept = edgeOffsets[from];
+    for (int e = edgeOffsets[from]; e < edgeOffsets[from + 1]; e++)
+    {
+        if (edgeTargets[e] == to)
+            continue;
+        edgeTargets[kept] = edgeTargets[e];
+        edgeWeights[kept] = edgeWeights[e];
+        if (!edgeProfile.empty())
+            edgeProfile[kept] = edgeProfile[e];
+        kept++;
+    }
 
-    //wastearea12
-    bwm.addWaste(Waste("Udyambag", 6000));
+    int removed = edgeOffsets[from + 1] - kept;
+    if (removed == 0)
+        return false;
 
-    //wastearea13
-    bwm.addWaste(Waste("Bogarves", 6500));
+    edgeTargets.erase(edgeTargets.begin() + kept, edgeTargets.begin() + edgeOffsets[from + 1]);
+    edgeWeights.erase(edgeWeights.begin() + kept, edgeWeights.begin() + edgeOffsets[from + 1]);
+    if (!edgeProfile.empty())
+        edgeProfile.erase(edgeProfile.begin() + kept, edgeProfile.begin() + edgeOffsets[from + 1]);
+    for (int u = from + 1; u <= n; u++)
+    {
+        edgeOffsets[u] -= removed;
+    }
 
+    roadChanged(from, to, before);
+    return true;
+}
 
-    //wastearea14
-    bwm.addWaste(Waste("Goaves", 7000));
 
-    //wastearea15
-    bwm.addWaste(Waste("Hindwadi", 7500));
+// Sets the length of every road from -> to
+bool setRoadWeight(int from, int to, int weight)
+{
+    int n = areas.size();
+    if (from < 0 || from >= n || to < 0 || to >= n || weight < 0)
+        return false;
 
-    //wastearea16
-    bwm.addWaste(Waste("Mache", 8000));
+    int before = directRoadWeight(from, to);
+    if (before == std::numeric_limits<int>::max())
+        return false;
 
-    //wastearea17
-    bwm.addWaste(Waste("Malmaruti", 8500));
+    for (int e = edgeOffsets[from]; e < edgeOffsets[from + 1]; e++)
+    {
+        if (edgeTargets[e] == to)
+            edgeWeights[e] = weight;
+    }
 
-    //wastearea18
-    bwm.addWaste(Waste("Nemgoa", 9000));
+    roadChanged(from, to, before);
+    return true;
+}
 
-    //wastearea19
-    bwm.addWaste(Waste("Shahpur", 9500));
 
-    //wastearea20
-    bwm.addWaste(Waste("Sambhaji Nagar", 10000));
+// After an edit to the roads from -> to, whose shortest length was before: stale
+// structures are rebuilt on demand, but an up-to-date all-pairs table is repaired in place
+void roadChanged(int from, int to, int before)
+{
+    bool tableCurrent = allPairsVersion == graphVersion && !allPairsNext.empty();
+    invalidateRoutes();
+    if (!tableCurrent)
+        return;
 
-    //wastearea21
-    bwm.addWaste(Waste("Angol", 10500));
+    int after = directRoadWeight(from, to);
+    if (after < before)
+        repairAllPairsAfterDecrease(from, to, after);
+    else if (after > before)
+        repairAllPairsAfterIncrease(from, to);
+    allPairsVersion = graphVersion;
+}
 
-    //wastearea22
-    bwm.addWaste(Waste("Balekundri", 11000));
 
-    //wastearea23
-    bwm.addWaste(Waste("Camp", 11500));
-    //wastearea24
-    bwm.addWaste(Waste("Dharamnath", 12000));
+// The best road u -> v became shorter (or new): a route can only improve by using it,
+// and then it is the table route to u, the road, then the table route from v
+long long repairAllPairsAfterDecrease(int u, int v, int weight)
+{
+    const int INF = std::numeric_limits<int>::max();
+    int n = areas.size();
+    long long changed = 0;
 
-    //wastearea25
-    bwm.addWaste(Waste("Fort Lake", 12500));
+    for (int i = 0; i < n; i++)
+    {
+        if (allPairsDistance[i][u] == INF) continue;
 
+        long long toV = static_cast<long long>(allPairsDistance[i][u]) + weight;
+        int hop = i == u ? v : allPairsNext[i][u];
+        for (int j = 0; j < n; j++)
+        {
+            if (allPairsDistance[v][j] == INF) continue;
 
-    int choice;
+            long long through = toV + allPairsDistance[v][j];
+            if (through < allPairsDistance[i][j])
+            {
+                allPairsDistance[i][j] = static_cast<int>(through);
+                allPairsNext[i][j] = hop;
+                changed++;
+            }
+        }
+    }
+    return changed;
+}
 
-    do
-      {
 
-        bwm.displayMenu();
-        std::cout << "Enter your choice: ";
-        std::cin >> choice;
+// The best road u -> v became longer or closed. The next hops toward each destination j
+// form a tree; only areas in u's subtree of a tree that used the road can change. Those
+// are reset from their unaffected neighbours and then settled by a Dijkstra over the
+// affected areas alone (dynamic single-source repair, run per destination on reversed roads)
+long long repairAllPairsAfterIncrease(int u, int v)
+{
+    const int INF = std::numeric_limits<int>::max();
+    int n = areas.size();
+    if (reverseVersion != graphVersion)
+    {
+        buildReverseNetwork();
+    }
 
+    // 0 not yet known, 1 routes through the road, 2 does not
+    std::vector<char> state(n);
+    std::vector<int> chain, affected, before;
+    long long changed = 0;
 
-        // Handle invalid input for menu choice
-        if(std::cin.fail())
-          {
-            std::cin.clear();
-             // clear error flag
-            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            // ignore invalid input
-            std::cout << "Invalid input. Please enter a valid number.\n";
-            continue;
+    for (int j = 0; j < n; j++)
+    {
+        if (j == u || allPairsNext[u][j] != v) continue;
 
+        std::fill(state.begin(), state.end(), 0);
+        state[j] = 2;
+        state[u] = 1;
+        affected.clear();
+        for (int i = 0; i < n; i++)
+        {
+            chain.clear();
+            int at = i;
+            while (at != -1 && state[at] == 0)
+            {
+                chain.push_back(at);
+                at = allPairsNext[at][j];
+            }
+            char result = at == -1 ? 2 : state[at];
+            for (int c : chain)
+            {
+                state[c] = result;
+            }
+        }
+        for (int i = 0; i < n; i++)
+        {
+            if (state[i] == 1)
+                affected.push_back(i);
         }
 
-        switch (choice)
-         {
-
-        case 1:
-          {
-
-            int wasteIndex;
-             std::cout << "Enter destination area index:\n";
-              std::cout << "1: Kanabargi\n";
-              std::cout << "2: Belgaum\n";
-              std::cout << "3: Shivaji Nagar\n";
-              std::cout << "4: Tilakwadi\n";
-              std::cout << "5: Chennamma Nagar\n";
-              std::cout << "6: Gandhinagar\n";
-              std::cout << "7: APMC Yard\n";
-              std::cout << "8: City Market\n";
-              std::cout << "9: Fort Road\n";
-              std::cout << "10: Engg College Road\n";
-              std::cout << "11: Khanapur Road\n";
-              std::cout << "12: Udyambag\n";
-              std::cout << "13: Bogarves\n";
-              std::cout << "14: Goaves\n";
-              std::cout << "15: Hindwadi\n";
-              std::cout << "16: Mache\n";
-              std::cout << "17: Malmaruti\n";
-              std::cout << "18: Nemgoa\n";
-              std::cout << "19: Shahpur\n";
-              std::cout << "20: Sambhaji Nagar\n";
-              std::cout << "21: Angol\n";
-              std::cout << "22: Balekundri\n";
-              std::cout << "23: Camp\n";
-              std::cout << "24: Dharamnath\n";
-              std::cout << "25: Fort Lake\n";
-            std::cin >> wasteIndex;
-            if(wasteIndex < 1 || wasteIndex > 25)
-              {
-
-                std::cout << "Invalid waste index. Please enter a number between 1 and 25.\n";
+        std::priority_queue<std::pair<long long, int>, std::vector<std::pair<long long, int>>, std::greater<>> pq;
+        before.clear();
+        for (int x : affected)
+        {
+            before.push_back(allPairsDistance[x][j]);
+            long long best = INF;
+            int hop = -1;
+            for (int e = edgeOffsets[x]; e < edgeOffsets[x + 1]; e++)
+            {
+                int y = edgeTargets[e];
+                if (state[y] == 2 && allPairsDistance[y][j] != INF &&
+                    edgeWeights[e] + static_cast<long long>(allPairsDistance[y][j]) < best)
+                {
+                    best = edgeWeights[e] + static_cast<long long>(allPairsDistance[y][j]);
+                    hop = y;
+                }
             }
-            else
-              {
+            allPairsDistance[x][j] = static_cast<int>(best);
+            allPairsNext[x][j] = hop;
+            if (hop != -1)
+                pq.push({best, x});
+        }
 
-                bwm.allotVehicle(wasteIndex - 1);
+        while (!pq.empty())
+        {
+            auto [dist, x] = pq.top();
+            pq.pop();
+            if (dist > allPairsDistance[x][j]) continue;
+
+            for (int e = reverseOffsets[x]; e < reverseOffsets[x + 1]; e++)
+            {
+                int z = reverseSources[e];
+                long long through = dist + reverseWeights[e];
+                if (state[z] == 1 && through < allPairsDistance[z][j])
+                {
+                    allPairsDistance[z][j] = static_cast<int>(through);
+                    allPairsNext[z][j] = x;
+                    pq.push({through, z});
+                }
             }
+        }
 
-            break;
+        for (size_t k = 0; k < affected.size(); k++)
+        {
+            if (allPairsDistance[affected[k]][j] != before[k])
+                changed++;
         }
+    }
+    return changed;
+}
 
 
-        case 2:
-            bwm.displayVehicles();
-            break;
+// Returns the shortest route from source to destination as area indexes
+// (empty if unreachable) and stores its length in totalDistance
+std::vector<int> shortestPath(int source, int destination, int& totalDistance)
+{
+    const RouteCache::Entry& cached = cachedShortestPath(source, destination);
+    totalDistance = cached.distance;
+    return *cached.path;
+}
 
 
-        case 3:
-            bwm.displayDrivers();
-            break;
+// The shortest route through the route cache: a repeated query is a hash lookup
+const RouteCache::Entry& cachedShortestPath(int source, int destination)
+{
+    if (RouteCache::Entry* cached = routeCache.find(source, destination, graphVersion))
+    {
+        return *cached;
+    }
 
+    RouteCache::Entry entry;
+    std::vector<int> path = computeShortestPath(source, destination, entry.distance);
+    entry.path = std::make_shared<const std::vector<int>>(std::move(path));
+    return routeCache.insert(source, destination, graphVersion, std::move(entry));
+}
 
-        case 4:
-            bwm.displayWastes();
-            break;
 
+// A path of area indexes as interned area name ids
+std::vector<std::int32_t> internRoute(const std::vector<int>& path)
+{
+    std::vector<std::int32_t> route;
+    route.reserve(path.size());
+    for (int area : path)
+    {
+        route.push_back(allocationStrings.intern(areas[area]));
+    }
+    return route;
+}
 
-        case 5:
-           {
 
-            int destination;
-            std::cout << "Enter destination area index (1: Kanabargi, 2: Belgaum, 3: Shivaji Nagar, ... 25: Fort Lake): ";
+// Route cache size and hit counts
+const RouteCache& getRouteCache() const
+{
+    return routeCache;
+}
 
-            std::cin >> destination;
 
-            if(destination < 1 || destination > 25)
-              {
+void setRouteCacheCapacity(std::size_t capacity)
+{
+    routeCache.setCapacity(capacity);
+}
 
-                std::cout << "Invalid destination. Please enter a number between 1 and 25.\n";
 
-            }
-             else
-              {
+// Shortest route without the cache: the all-pairs table, the contraction hierarchy or a search
+std::vector<int> computeShortestPath(int source, int destination, int& totalDistance)
+{
+    if (allPairsVersion != graphVersion)
+    {
+        buildAllPairsShortestPaths();
+    }
 
-                int source = 0; // Kanabargi
-                bwm.findShortestRouteToDestination(source, destination - 1);
-            }
-            break;
-        }
+    std::vector<int> path;
+    if (allPairsNext.empty())
+    {
+        // Network too large for the table: use the contraction hierarchy if one is
+        // built for this network, otherwise search for this query only
+        long long settled = 0;
+        RouteAlgorithm algorithm = hierarchyVersion == graphVersion ? RouteAlgorithm::Hierarchy : routeAlgorithm;
+        return routeQuery(source, destination, algorithm, totalDistance, settled);
+    }
 
+    if (allPairsNext[source][destination] == -1)
+    {
+        return path;
+    }
 
-        case 6:
-          {
+    totalDistance = allPairsDistance[source][destination];
+    for (int at = source; at != destination; at = allPairsNext[at][destination])
+    {
+        path.push_back(at);
+    }
+    path.push_back(destination);
 
-            int destination;
-           std::cout << "Enter destination area index:\n";
-              std::cout << "1: Kanabargi\n";
-              std::cout << "2: Belgaum\n";
-              std::cout << "3: Shivaji Nagar\n";
-              std::cout << "4: Tilakwadi\n";
-              std::cout << "5: Chennamma Nagar\n";
-              std::cout << "6: Gandhinagar\n";
-              std::cout << "7: APMC Yard\n";
-              std::cout << "8: City Market\n";
-              std::cout << "9: Fort Road\n";
-              std::cout << "10: Engg College Road\n";
-              std::cout << "11: Khanapur Road\n";
-              std::cout << "12: Udyambag\n";
-              std::cout << "13: Bogarves\n";
-              std::cout << "14: Goaves\n";
-              std::cout << "15: Hindwadi\n";
-              std::cout << "16: Mache\n";
-              std::cout << "17: Malmaruti\n";
-              std::cout << "18: Nemgoa\n";
-              std::cout << "19: Shahpur\n";
-              std::cout << "20: Sambhaji Nagar\n";
-              std::cout << "21: Angol\n";
-              std::cout << "22: Balekundri\n";
-              std::cout << "23: Camp\n";
-              std::cout << "24: Dharamnath\n";
-              std::cout << "25: Fort Lake\n";
-            std::cin >> destination;
-            if(destination < 1 || destination > 25)
-              {
+    return path;
+}
 
-                std::cout << "Invalid destination. Please enter a number between 1 and 25.\n";
-            }
-            else
-              {
-                int source = 0;
-                // Kanabargi
 
-                bwm.findLongestRouteToDestination(source, destination - 1);
-            }
+// Great-circle distance in km between two areas with known coordinates
+double straightLineKm(int a, int b) const
+{
+    const double EARTH_RADIUS_KM = 6371.0;
+    const double RADIANS = 3.14159265358979323846 / 180.0;
+
+    double dLat = (areaLatitude[b] - areaLatitude[a]) * RADIANS;
+    double dLon = (areaLongitude[b] - areaLongitude[a]) * RADIANS;
+    double h = std::sin(dLat / 2) * std::sin(dLat / 2) +
+               std::cos(areaLatitude[a] * RADIANS) * std::cos(areaLatitude[b] * RADIANS) *
+               std::sin(dLon / 2) * std::sin(dLon / 2);
+    return 2 * EARTH_RADIUS_KM * std::asin(std::sqrt(std::min(1.0, h)));
+}
 
-            break;
+
+// Works out how many road units each straight-line km is worth at least, so that
+// heuristicScale * straightLineKm never overestimates and A* stays exact.
+// A* only uses coordinates when every area has them; otherwise the scale is 0.
+void buildHeuristic()
+{
+    heuristicVersion = graphVersion;
+    heuristicScale = 0.0;
+
+    int n = areas.size();
+    for (int u = 0; u < n; u++)
+    {
+        if (std::isnan(areaLatitude[u]) || std::isnan(areaLongitude[u]))
+            return;
+    }
+
+    double scale = std::numeric_limits<double>::infinity();
+    for (int u = 0; u < n; u++)
+    {
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            double km = straightLineKm(u, edgeTargets[e]);
+            if (km > 0)
+            {
+                scale = std::min(scale, edgeWeights[e] / km);
+            }
         }
+    }
 
-        case 7:
-            bwm.viewAvailableVehiclesAndDrivers();
-            break;
+    if (scale != std::numeric_limits<double>::infinity())
+    {
+        // A little slack for rounding in the road lengths
+        heuristicScale = scale * 0.999;
+    }
+}
 
 
-        case 8:
-            bwm.displayCollectedWasteByDate();
-            break;
+// Builds the reversed road network used by the backward half of bidirectional search
+void buildReverseNetwork()
+{
+    int n = areas.size();
+    reverseVersion = graphVersion;
 
+    reverseOffsets.assign(n + 1, 0);
+    for (int target : edgeTargets)
+    {
+        reverseOffsets[target + 1]++;
+    }
+    for (int u = 0; u < n; u++)
+    {
+        reverseOffsets[u + 1] += reverseOffsets[u];
+    }
 
-        case 9:
-            bwm.storeDataInFile();
+    reverseSources.resize(edgeTargets.size());
+    reverseWeights.resize(edgeTargets.size());
+    std::vector<int> next(reverseOffsets.begin(), reverseOffsets.end() - 1);
+    for (int u = 0; u < n; u++)
+    {
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            int slot = next[edgeTargets[e]]++;
+            reverseSources[slot] = u;
+            reverseWeights[slot] = edgeWeights[e];
+        }
+    }
+}
 
-            break;
 
+// Forward search from source: plain Dijkstra, stopping at the destination when asked,
+// with the A* heuristic added to the queue key when useHeuristic is set
+std::vector<int> forwardSearch(int source, int destination, bool stopAtDestination, bool useHeuristic,
+                               int& totalDistance, long long& settled)
+{
+    const long long INF = std::numeric_limits<long long>::max();
+    int n = areas.size();
 
+    if (useHeuristic && heuristicVersion != graphVersion)
+    {
+        buildHeuristic();
+    }
+    double scale = useHeuristic ? heuristicScale : 0.0;
+    auto estimate = [&](int v) -> double
+    {
+        return scale > 0 ? scale * straightLineKm(v, destination) : 0.0;
+    };
 
-        case 10:
+    std::vector<long long> distance(n, INF);
+    std::vector<int> parent(n, -1);
+    std::vector<bool> done(n, false);
+    std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> pq;
 
-          {
+    distance[source] = 0;
+    pq.push({estimate(source), source});
+    settled = 0;
 
-            std::string filename = "C:\\Users\\mahes\\OneDrive\\Desktop\\route management\\dateDATA.txt";
-            //file path
+    while (!pq.empty())
+    {
+        int u = pq.top().second;
+        pq.pop();
+        if (done[u]) continue;
 
+        done[u] = true;
+        settled++;
+        if (stopAtDestination && u == destination) break;
 
-            bwm.loadDataFromFile(filename);
-            break;
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            int v = edgeTargets[e];
+            long long newDist = distance[u] + edgeWeights[e];
+            if (newDist < distance[v])
+            {
+                distance[v] = newDist;
+                parent[v] = u;
+                pq.push({newDist + estimate(v), v});
+            }
         }
+    }
+
+    std::vector<int> path;
+    if (distance[destination] == INF)
+        return path;
+
+    totalDistance = static_cast<int>(distance[destination]);
+    for (int at = destination; at != -1; at = parent[at])
+    {
+        path.push_back(at);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
 
 
+// Dijkstra from both ends at once, always advancing the side with the smaller queue key;
+// done once the two keys together reach the best source-to-destination length seen
+std::vector<int> bidirectionalSearch(int source, int destination, int& totalDistance, long long& settled)
+{
+    const long long INF = std::numeric_limits<long long>::max();
+    int n = areas.size();
 
-        case 11:
-            std::cout << "Exiting the program." << std::endl;
-            break;
+    if (reverseVersion != graphVersion)
+    {
+        buildReverseNetwork();
+    }
 
-        default:
+    std::vector<long long> distance[2] = {std::vector<long long>(n, INF), std::vector<long long>(n, INF)};
+    std::vector<int> parent[2] = {std::vector<int>(n, -1), std::vector<int>(n, -1)};
+    std::vector<bool> done[2] = {std::vector<bool>(n, false), std::vector<bool>(n, false)};
+    std::priority_queue<std::pair<long long, int>, std::vector<std::pair<long long, int>>, std::greater<>> pq[2];
 
-            std::cout << "Invalid choice. Please try again." << std::endl;
-        }
+    const std::vector<int>* offsets[2] = {&edgeOffsets, &reverseOffsets};
+    const std::vector<int>* targets[2] = {&edgeTargets, &reverseSources};
+    const std::vector<int>* weights[2] = {&edgeWeights, &reverseWeights};
 
+    distance[0][source] = 0;
+    distance[1][destination] = 0;
+    pq[0].push({0, source});
+    pq[1].push({0, destination});
 
-    } while (choice != 11);
+    long long best = source == destination ? 0 : INF;
+    int meet = source == destination ? source : -1;
+    settled = 0;
 
+    while (!pq[0].empty() && !pq[1].empty())
+    {
+        if (best != INF && pq[0].top().first + pq[1].top().first >= best)
+            break;
 
-    return 0;
+        int side = pq[0].top().first <= pq[1].top().first ? 0 : 1;
+        int u = pq[side].top().second;
+        pq[side].pop();
+        if (done[side][u]) continue;
+
+        done[side][u] = true;
+        settled++;
 
+        for (int e = (*offsets[side])[u]; e < (*offsets[side])[u + 1]; e++)
+        {
+            int v = (*targets[side])[e];
+            long long newDist = distance[side][u] + (*weights[side])[e];
+            if (newDist < distance[side][v])
+            {
+                distance[side][v] = newDist;
+                parent[side][v] = u;
+                pq[side].push({newDist, v});
+            }
+            if (distance[1 - side][v] != INF && newDist + distance[1 - side][v] < best)
+            {
+                best = newDist + distance[1 - side][v];
+                meet = v;
+            }
+        }
+    }
+
+    std::vector<int> path;
+    if (meet == -1)
+        return path;
 
+    totalDistance = static_cast<int>(best);
+    for (int at = meet; at != -1; at = parent[0][at])
+    {
+        path.push_back(at);
+    }
+    std::reverse(path.begin(), path.end());
+    for (int at = parent[1][meet]; at != -1; at = parent[1][at])
+    {
+        path.push_back(at);
+    }
+    return path;
 }
 
 
-//module1
-#include <iostream>
-#include <fstream>
-#include <iomanip>
-#include <vector>
-#include <string>
-#include <algorithm>
-#include <map>
+// One point-to-point query with the chosen algorithm; settled counts the areas taken off
+// the queue, the work each algorithm did. Returns an empty route if there is none.
+std::vector<int> routeQuery(int source, int destination, RouteAlgorithm algorithm, int& totalDistance, long long& settled)
+{
+    switch (algorithm)
+    {
+    case RouteAlgorithm::Dijkstra:
+        return forwardSearch(source, destination, false, false, totalDistance, settled);
+    case RouteAlgorithm::EarlyExit:
+        return forwardSearch(source, destination, true, false, totalDistance, settled);
+    case RouteAlgorithm::Bidirectional:
+        return bidirectionalSearch(source, destination, totalDistance, settled);
+    case RouteAlgorithm::Hierarchy:
+        if (hierarchyVersion != graphVersion)
+        {
+            buildContractionHierarchy();
+        }
+        return hierarchyQuery(source, destination, totalDistance, settled);
+    case RouteAlgorithm::AStar:
+    default:
+        return forwardSearch(source, destination, true, true, totalDistance, settled);
+    }
+}
 
-using namespace std;
 
-class Area
+// Contraction hierarchy preprocessing
+// Areas are contracted one at a time, least important first (fewest shortcuts added
+// relative to arcs removed). Contracting v adds a shortcut u -> w for each pair of
+// neighbours whose shortest route runs through v, which a bounded "witness" Dijkstra
+// that avoids v fails to beat. A missed witness only costs an extra shortcut.
+void buildContractionHierarchy()
 {
-public:
-    string name;
-    string address;
-    string city;
+    const long long INF = std::numeric_limits<long long>::max();
+    const int WITNESS_LIMIT = 200;
+    const int SIMULATE_LIMIT = 50;
+    int n = areas.size();
+    auto startTime = std::chrono::steady_clock::now();
+
+    // Working graph of the areas not yet contracted; the weight is copied in so the
+    // witness searches do not have to look up every arc
+    struct Link
+    {
+        int area;
+        int arc;
+        int weight;
+    };
 
-    void display() const
+    hierarchyArcs.clear();
+    std::vector<std::vector<Link>> outArcs(n), inArcs(n);
+    for (int u = 0; u < n; u++)
     {
-        cout << left << setw(30) << name << setw(50) << address << setw(30) << city << endl;
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            int arc = hierarchyArcs.size();
+            hierarchyArcs.push_back({u, edgeTargets[e], edgeWeights[e], -1, -1});
+            outArcs[u].push_back({edgeTargets[e], arc, edgeWeights[e]});
+            inArcs[edgeTargets[e]].push_back({u, arc, edgeWeights[e]});
+        }
     }
-};
 
-class AreaDatabase
-{
-private:
-    vector<Area> areas;
-    map<string, double> populationData;
+    std::vector<bool> contracted(n, false);
+    std::vector<int> contractedNeighbours(n, 0);
+    // Length of the longest chain of contracted areas below each area; keeps the hierarchy shallow
+    std::vector<int> depth(n, 0);
+    std::vector<long long> witnessDistance(n, INF);
+    std::vector<int> witnessTouched;
+    // Areas the current witness search still has to settle, marked with the search number
+    std::vector<int> targetMark(n, -1);
+    int searchNumber = 0;
+    std::vector<std::pair<long long, int>> heap;
 
-public:
-    void displayWelcomeMessage() const;
-    void loadFromFile();
-    void displayAllAreas() const;
-    void updateAreaData();
-    void deleteAreaByName();
-    void addNewArea();
-    void saveToFile() const;
-    void enterPopulationData();
-    void calculateWasteGeneration() const;
-    void sortAreasByName();
-    void filterAreasByCity();
-    void exportToCSV() const;
-    void calculateAveragePopulation() const;
-    void printPopulationStats() const;
-    void calculateAverageWasteGeneration() const; // New function declaration
-};
+    // Contracts v (or only counts the shortcuts it would need when simulating)
+    auto contract = [&](int v, bool simulate) -> int
+    {
+        int shortcuts = 0;
+        int limit = simulate ? SIMULATE_LIMIT : WITNESS_LIMIT;
 
+        for (const Link& in : inArcs[v])
+        {
+            int u = in.area;
+            if (contracted[u] || u == v) continue;
 
-void AreaDatabase::displayWelcomeMessage() const {
-    for (int i = 0; i < 80; i++) cout << "*";
-    cout << "\n\n\t\t\t\tAREA_INFO\n\n\n";
-    for (int i = 0; i < 80; i++) cout << "*";
-    cout << "\n\n";
-}
-void AreaDatabase::loadFromFile()
-{
-    string filename;
-    cout << "Enter the filename to load area data from: ";
-    cin >> filename;
-    ifstream file(filename);
+            long long maxCandidate = -1;
+            int targetsLeft = 0;
+            searchNumber++;
+            for (const Link& out : outArcs[v])
+            {
+                int w = out.area;
+                if (contracted[w] || w == u || w == v) continue;
 
-    if (!file)
+                maxCandidate = std::max(maxCandidate, static_cast<long long>(in.weight) + out.weight);
+                if (targetMark[w] != searchNumber)
+                {
+                    targetMark[w] = searchNumber;
+                    targetsLeft++;
+                }
+            }
+            if (maxCandidate < 0) continue;
+
+            // Witness search from u in the remaining graph without v, until every
+            // neighbour w is settled, the candidate length is passed, or the limit is hit
+            heap.clear();
+            witnessDistance[u] = 0;
+            witnessTouched.push_back(u);
+            heap.push_back({0, u});
+            int settled = 0;
+            while (!heap.empty() && settled < limit && targetsLeft > 0)
+            {
+                std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+                auto [dist, x] = heap.back();
+                heap.pop_back();
+                if (dist > witnessDistance[x]) continue;
+                if (dist > maxCandidate) break;
+                settled++;
+                if (targetMark[x] == searchNumber) targetsLeft--;
+
+                for (const Link& link : outArcs[x])
+                {
+                    int y = link.area;
+                    if (y == v) continue;
+
+                    long long newDist = dist + link.weight;
+                    if (newDist < witnessDistance[y])
+                    {
+                        if (witnessDistance[y] == INF) witnessTouched.push_back(y);
+                        witnessDistance[y] = newDist;
+                        heap.push_back({newDist, y});
+                        std::push_heap(heap.begin(), heap.end(), std::greater<>());
+                    }
+                }
+            }
+
+            for (const Link& out : outArcs[v])
+            {
+                int w = out.area;
+                if (contracted[w] || w == u || w == v) continue;
+
+                long long through = static_cast<long long>(in.weight) + out.weight;
+                if (witnessDistance[w] <= through) continue;
+
+                // An existing arc u -> w that is longer is simply replaced
+                auto existing = std::find_if(outArcs[u].begin(), outArcs[u].end(),
+                                             [w](const Link& link) { return link.area == w; });
+                if (existing != outArcs[u].end() && existing->weight <= through) continue;
+
+                shortcuts++;
+                if (!simulate)
+                {
+                    int arc = hierarchyArcs.size();
+                    hierarchyArcs.push_back({u, w, static_cast<int>(through), in.arc, out.arc});
+                    if (existing != outArcs[u].end())
+                    {
+                        int replaced = existing->arc;
+                        *existing = {w, arc, static_cast<int>(through)};
+                        for (Link& link : inArcs[w])
+                        {
+                            if (link.arc == replaced) link = {u, arc, static_cast<int>(through)};
+                        }
+                    }
+                    else
+                    {
+                        outArcs[u].push_back({w, arc, static_cast<int>(through)});
+                        inArcs[w].push_back({u, arc, static_cast<int>(through)});
+                    }
+                }
+            }
+
+            for (int x : witnessTouched)
+            {
+                witnessDistance[x] = INF;
+            }
+            witnessTouched.clear();
+        }
+        return shortcuts;
+    };
+
+    auto priority = [&](int v) -> int
     {
-        cout << "Error: File \"" << filename << "\" not found.\n";
-        return;
-    }
+        int removed = 0;
+        for (const Link& link : inArcs[v]) removed += !contracted[link.area];
+        for (const Link& link : outArcs[v]) removed += !contracted[link.area];
+        return 2 * contract(v, true) - removed + contractedNeighbours[v] + depth[v];
+    };
 
-    areas.clear();
-    Area temp;
+    // Queue entries whose priority is no longer the area's current one are skipped
+    std::vector<int> currentPriority(n);
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>> order;
+    for (int v = 0; v < n; v++)
+    {
+        currentPriority[v] = priority(v);
+        order.push({currentPriority[v], v});
+    }
 
-    int lineCount = 0;
-    int errorsCount = 0;
-    string line;
-    while (getline(file, line))
+    hierarchyRank.assign(n, 0);
+    int nextRank = 0;
+    while (!order.empty())
     {
-        lineCount++;
-        stringstream ss(line);
-        string name, address, city;
+        auto [queued, v] = order.top();
+        order.pop();
+        if (contracted[v] || queued != currentPriority[v]) continue;
 
-        // Try to parse the line
-        if (getline(ss, name, ',') && getline(ss, address, ',') && getline(ss, city)) {
-            temp.name = name;
-            temp.address = address;
-            temp.city = city;
-            areas.push_back(temp);
+        // Lazy update: re-check the priority and put v back if it is no longer the smallest
+        int current = priority(v);
+        if (current != queued)
+        {
+            currentPriority[v] = current;
+            if (!order.empty() && current > order.top().first)
+            {
+                order.push({current, v});
+                continue;
+            }
         }
-        else
+
+        contract(v, false);
+        contracted[v] = true;
+        hierarchyRank[v] = nextRank++;
+
+        // Neighbours gained shortcuts and lost a neighbour, so their priorities moved
+        std::vector<int> neighbours;
+        for (const Link& link : inArcs[v]) neighbours.push_back(link.area);
+        for (const Link& link : outArcs[v]) neighbours.push_back(link.area);
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        auto isContracted = [&contracted](const Link& link) { return contracted[link.area]; };
+        for (int u : neighbours)
         {
-            // Handle parsing error
-            cout << "Error parsing line " << lineCount << ": " << line << endl;
-            errorsCount++;
+            if (contracted[u]) continue;
+
+            // Drop arcs to contracted areas so later searches do not walk over them
+            outArcs[u].erase(std::remove_if(outArcs[u].begin(), outArcs[u].end(), isContracted), outArcs[u].end());
+            inArcs[u].erase(std::remove_if(inArcs[u].begin(), inArcs[u].end(), isContracted), inArcs[u].end());
+
+            contractedNeighbours[u]++;
+            depth[u] = std::max(depth[u], depth[v] + 1);
+            currentPriority[u] = priority(u);
+            order.push({currentPriority[u], u});
         }
     }
 
-    file.close();
+    buildHierarchySearchGraph();
 
-    if (errorsCount == 0)
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::cout << "Contraction hierarchy built: " << n << " areas, " << edgeTargets.size() << " roads, "
+              << hierarchyArcs.size() - edgeTargets.size() << " shortcuts in " << seconds << " s" << std::endl;
+}
+
+
+// Splits the hierarchy arcs into the upward CSR (by tail) and the downward CSR (by head)
+void buildHierarchySearchGraph()
+{
+    int n = areas.size();
+    upOffsets.assign(n + 1, 0);
+    downOffsets.assign(n + 1, 0);
+    for (const HierarchyArc& arc : hierarchyArcs)
     {
-        cout << "Area data successfully loaded from file \"" << filename << "\".\n";
+        if (hierarchyRank[arc.from] < hierarchyRank[arc.to])
+            upOffsets[arc.from + 1]++;
+        else
+            downOffsets[arc.to + 1]++;
     }
-    else
+    for (int u = 0; u < n; u++)
     {
-        cout << errorsCount << " errors occurred during file loading.\n";
-        cout << "Some areas may not have been added correctly.\n";
+        upOffsets[u + 1] += upOffsets[u];
+        downOffsets[u + 1] += downOffsets[u];
     }
 
-    // Display the number of lines loaded and errors encountered
-    cout << lineCount << " total lines processed.\n";
-    if (errorsCount > 0)
+    upArcs.resize(upOffsets[n]);
+    downArcs.resize(downOffsets[n]);
+    std::vector<int> nextUp(upOffsets.begin(), upOffsets.end() - 1);
+    std::vector<int> nextDown(downOffsets.begin(), downOffsets.end() - 1);
+    for (int a = 0; a < static_cast<int>(hierarchyArcs.size()); a++)
     {
-        cout << errorsCount << " lines could not be parsed correctly.\n";
+        const HierarchyArc& arc = hierarchyArcs[a];
+        if (hierarchyRank[arc.from] < hierarchyRank[arc.to])
+            upArcs[nextUp[arc.from]++] = a;
+        else
+            downArcs[nextDown[arc.to]++] = a;
     }
-    else
+
+    for (int side = 0; side < 2; side++)
     {
-        cout << "All lines were successfully parsed.\n";
+        hierarchyDistance[side].assign(n, std::numeric_limits<long long>::max());
+        hierarchyParent[side].assign(n, -1);
     }
+    hierarchyTouched.clear();
+    hierarchyVersion = graphVersion;
+}
 
-    // Optionally, print out the loaded areas if no errors
-    if (errorsCount == 0)
+
+// Appends the roads behind a hierarchy arc to path (without its first area)
+void unpackHierarchyArc(int arc, std::vector<int>& path) const
+{
+    std::vector<int> pending = {arc};
+    while (!pending.empty())
     {
-        cout << "Displaying all areas loaded from the file:\n";
-        displayAllAreas();
-    }
-    else
-    {
-        cout << "Displaying only the correctly loaded areas:\n";
-        for (const auto& area : areas)
+        const HierarchyArc& current = hierarchyArcs[pending.back()];
+        pending.pop_back();
+        if (current.firstChild == -1)
         {
-            area.display();
+            path.push_back(current.to);
+        }
+        else
+        {
+            pending.push_back(current.secondChild);
+            pending.push_back(current.firstChild);
         }
     }
+}
 
-    // Ask the user if they want to reload the data or proceed
-    char choice;
-    cout << "Would you like to reload the data from another file (y/n)? ";
-    cin >> choice;
-    if (choice == 'y' || choice == 'Y') {
-        loadFromFile();
-    }
-     else
+
+// Shortest route through the contraction hierarchy: Dijkstra upwards from the source and
+// (on reversed arcs) upwards from the destination; the route meets at its highest area
+std::vector<int> hierarchyQuery(int source, int destination, int& totalDistance, long long& settled)
+{
+    const long long INF = std::numeric_limits<long long>::max();
+    std::priority_queue<std::pair<long long, int>, std::vector<std::pair<long long, int>>, std::greater<>> pq[2];
+
+    for (int side = 0; side < 2; side++)
     {
-        cout << "Proceeding with the loaded data.\n";
+        int start = side == 0 ? source : destination;
+        hierarchyDistance[side][start] = 0;
+        pq[side].push({0, start});
     }
+    hierarchyTouched.push_back(source);
+    hierarchyTouched.push_back(destination);
 
-    // Example of additional parsing logic for handling extra data fields (if applicable)
-    char extraChoice;
-    cout << "Would you like to load additional data from another file (such as population data)? (y/n): ";
-    cin >> extraChoice;
-    if (extraChoice == 'y' || extraChoice == 'Y') {
-        string additionalFile;
-        cout << "Enter the filename for the additional data (e.g., population data): ";
-        cin >> additionalFile;
+    long long best = INF;
+    int meet = -1;
+    settled = 0;
 
-        ifstream additionalFileStream(additionalFile);
-        if (!additionalFileStream) {
-            cout << "Error: File \"" << additionalFile << "\" not found.\n";
-            return;
+    while (!pq[0].empty() || !pq[1].empty())
+    {
+        int side = pq[1].empty() || (!pq[0].empty() && pq[0].top().first <= pq[1].top().first) ? 0 : 1;
+        auto [dist, u] = pq[side].top();
+        if (dist >= best)
+        {
+            // Nothing left on this side can improve the route
+            pq[side] = {};
+            continue;
         }
+        pq[side].pop();
+        if (dist > hierarchyDistance[side][u]) continue;
+        settled++;
 
-        // This could be logic to process additional data
-        string areaName;
-        double population;
-        while (getline(additionalFileStream, areaName, ',') && additionalFileStream >> population) {
-            // Example additional processing logic for population data
-            // Assuming a map populationData exists, we can add it
-            areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end()); // Remove spaces
-            populationData[areaName] = population;
+        if (hierarchyDistance[1 - side][u] != INF && dist + hierarchyDistance[1 - side][u] < best)
+        {
+            best = dist + hierarchyDistance[1 - side][u];
+            meet = u;
         }
 
-        additionalFileStream.close();
-        cout << "Additional data loaded successfully from \"" << additionalFile << "\".\n";
-    }
-
-    // Adding logic to verify the consistency of data
-    if (areas.size() != populationData.size()) {
-        cout << "Warning: There is a mismatch between the number of areas and population data.\n";
-    } else {
-        cout << "Area and population data are consistent.\n";
+        const std::vector<int>& offsets = side == 0 ? upOffsets : downOffsets;
+        const std::vector<int>& arcs = side == 0 ? upArcs : downArcs;
+        for (int k = offsets[u]; k < offsets[u + 1]; k++)
+        {
+            const HierarchyArc& arc = hierarchyArcs[arcs[k]];
+            int v = side == 0 ? arc.to : arc.from;
+            long long newDist = dist + arc.weight;
+            if (newDist < hierarchyDistance[side][v])
+            {
+                if (hierarchyDistance[0][v] == INF && hierarchyDistance[1][v] == INF) hierarchyTouched.push_back(v);
+                hierarchyDistance[side][v] = newDist;
+                hierarchyParent[side][v] = arcs[k];
+                pq[side].push({newDist, v});
+            }
+        }
     }
 
-    // Provide options for validating data integrity
-    char validationChoice;
-    cout << "Would you like to validate the loaded data for correctness (y/n)? ";
-    cin >> validationChoice;
-    if (validationChoice == 'y' || validationChoice == 'Y')
+    std::vector<int> path;
+    if (meet != -1)
     {
-        cout << "Validating loaded data...\n";
-        int validCount = 0;
-        for (const auto& area : areas)
-       {
-            // Example validation: Check if the area has a valid city and address
-            if (!area.name.empty() && !area.address.empty() && !area.city.empty()) {
-                validCount++;
-            } else {
-                cout << "Invalid data detected for area: " << area.name << endl;
-            }
-        }
+        totalDistance = static_cast<int>(best);
 
-        cout << validCount << " valid areas found out of " << areas.size() << ".\n";
+        // Arcs from the source up to the meeting area, then down to the destination
+        std::vector<int> upward;
+        for (int at = meet; at != source; at = hierarchyArcs[hierarchyParent[0][at]].from)
+        {
+            upward.push_back(hierarchyParent[0][at]);
+        }
+        path.push_back(source);
+        for (auto it = upward.rbegin(); it != upward.rend(); ++it)
+        {
+            unpackHierarchyArc(*it, path);
+        }
+        for (int at = meet; at != destination; at = hierarchyArcs[hierarchyParent[1][at]].to)
+        {
+            unpackHierarchyArc(hierarchyParent[1][at], path);
+        }
     }
 
-    // Advanced option to handle file format errors more robustly
-    cout << "Would you like to attempt an auto-correction for file format issues (y/n)? ";
-    cin >> validationChoice;
-    if (validationChoice == 'y' || validationChoice == 'Y') {
-        cout << "Attempting to auto-correct file format issues...\n";
-        // Advanced auto-correction logic can be added here based on the file format (e.g., handling missing commas, fixing newlines, etc.)
+    for (int v : hierarchyTouched)
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            hierarchyDistance[side][v] = INF;
+            hierarchyParent[side][v] = -1;
+        }
     }
+    hierarchyTouched.clear();
 
-    // After all data is loaded, provide options to save the data back to a file if needed
-    char saveChoice;
-    cout << "Would you like to save the loaded data to a new file (y/n)? ";
-    cin >> saveChoice;
-    if (saveChoice == 'y' || saveChoice == 'Y') {
-        string newFileName;
-        cout << "Enter the filename to save the data: ";
-        cin >> newFileName;
-        ofstream saveFile(newFileName);
+    return path;
+}
 
-        if (!saveFile) {
-            cout << "Error: Could not open file \"" << newFileName << "\" for saving.\n";
-            return;
-        }
 
-        for (const auto& area : areas) {
-            saveFile << area.name << "," << area.address << "," << area.city << endl;
-        }
+// True when a contraction hierarchy is built or loaded for the current road network
+bool hasContractionHierarchy() const
+{
+    return hierarchyVersion == graphVersion;
+}
 
-        saveFile.close();
-        cout << "Data saved successfully to \"" << newFileName << "\".\n";
-    }
 
-    // Final confirmation and summary of loaded data
-    cout << "\nFinal Summary of Loaded Data:\n";
-    cout << "Total Areas Loaded: " << areas.size() << endl;
-    cout << "Total Population Data Entries: " << populationData.size() << endl;
-    cout << "Any errors or inconsistencies were addressed.\n";
-    cout << "Proceeding with program...\n";
-}
-void AreaDatabase::displayAllAreas() const {
-    if (areas.empty())
+// Fingerprint of the road network, stored with a saved hierarchy so it is never
+// loaded against a different network
+std::uint64_t networkFingerprint() const
+{
+    std::uint64_t hash = 1469598103934665603ULL;
+    auto mix = [&hash](std::uint64_t value)
     {
-        cout << "No area data to display. Please load data first.\n";
-        return;
-    }
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    };
 
-    // Sorting option for displaying areas
-    char sortChoice;
-    cout << "Would you like to sort the areas by name (y/n)? ";
-    cin >> sortChoice;
+    mix(areas.size());
+    for (int offset : edgeOffsets) mix(offset);
+    for (int target : edgeTargets) mix(target);
+    for (int weight : edgeWeights) mix(weight);
+    return hash;
+}
 
-    vector<Area> sortedAreas = areas;
 
-    if (sortChoice == 'y' || sortChoice == 'Y')
+// Writes the contraction hierarchy: "BWCH", network fingerprint, area count, arc count,
+// the contraction order, then every arc as from, to, weight, firstChild, secondChild
+bool saveContractionHierarchy(const std::string& filename)
+{
+    if (hierarchyVersion != graphVersion)
     {
-        sort(sortedAreas.begin(), sortedAreas.end(), [](const Area& a, const Area& b) {
-            return a.name < b.name;
-        });
-        cout << "Areas sorted by name.\n";
+        buildContractionHierarchy();
     }
 
-    else
+    std::ofstream outFile(filename, std::ios::binary | std::ios::trunc);
+    if (!outFile)
     {
-        cout << "Displaying areas without sorting.\n";
-    }
-
-    // Filter option to only show areas in a specific city
-    char filterChoice;
-    cout << "Would you like to filter the areas by city (y/n)? ";
-    cin >> filterChoice;
-
-    string filterCity;
-    if (filterChoice == 'y' || filterChoice == 'Y') {
-        cout << "Enter the city name to filter areas: ";
-        cin.ignore();  // To clear the newline left by previous input
-        getline(cin, filterCity);
+        std::cerr << "Error: Unable to open hierarchy file '" << filename << "' for writing.\n";
+        return false;
     }
 
-    // Display the headers
-    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-    cout << string(110, '-') << endl;
+    std::uint64_t fingerprint = networkFingerprint();
+    std::int32_t n = areas.size();
+    std::int32_t m = hierarchyArcs.size();
+    outFile.write("BWCH", 4);
+    outFile.write(reinterpret_cast<const char*>(&fingerprint), sizeof(fingerprint));
+    outFile.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    outFile.write(reinterpret_cast<const char*>(&m), sizeof(m));
+    outFile.write(reinterpret_cast<const char*>(hierarchyRank.data()), n * sizeof(int));
+    outFile.write(reinterpret_cast<const char*>(hierarchyArcs.data()), m * sizeof(HierarchyArc));
 
-    // Loop through the areas and display them
-    bool displayed = false;
-    for (const auto& area : sortedAreas) {
-        if (filterChoice == 'y' || filterChoice == 'Y') {
-            // Only display areas in the specified city
-            if (area.city == filterCity) {
-                area.display();
-                displayed = true;
-            }
-        }
+    return static_cast<bool>(outFile);
+}
 
-        else
-        {
-            // Display all areas if no filter is applied
-            area.display();
-            displayed = true;
-        }
-    }
 
-    if (!displayed)
+// True when rank and arcs form a hierarchy the searches can walk safely. The fingerprint
+// only says which network a file was built for, so a damaged file is caught here: the
+// ranks must be a permutation, every arc must join two areas, and a shortcut must be made
+// of two earlier arcs that meet, start and end where it does and add up to its length
+// (earlier, so that unpacking always ends)
+bool validHierarchy(const std::vector<int>& rank, const std::vector<HierarchyArc>& arcs) const
+{
+    int n = rank.size();
+    std::vector<char> seen(n, 0);
+    for (int r : rank)
     {
-        cout << "No areas found matching the filter criteria.\n";
+        if (r < 0 || r >= n || seen[r]) return false;
+        seen[r] = 1;
     }
 
-    // Option to display details for a specific area
-    char detailChoice;
-    cout << "Would you like to view more details about a specific area (y/n)? ";
-    cin >> detailChoice;
-
-    if (detailChoice == 'y' || detailChoice == 'Y')
+    for (int a = 0; a < static_cast<int>(arcs.size()); a++)
     {
-        string areaName;
-        cout << "Enter the area name to view details: ";
-        cin.ignore();  // Clear the newline
-        getline(cin, areaName);
-
-        bool found = false;
-        for (const auto& area : sortedAreas)
-        {
-            if (area.name == areaName)
-            {
-                found = true;
-                cout << "\nDetails for Area: " << area.name << endl;
-                cout << "Address: " << area.address << endl;
-                cout << "City: " << area.city << endl;
-                // You can add more detailed information here if needed, e.g., population, waste generation, etc.
-                break;
-            }
-        }
+        const HierarchyArc& arc = arcs[a];
+        if (arc.from < 0 || arc.from >= n || arc.to < 0 || arc.to >= n || arc.weight < 0) return false;
+        if (arc.firstChild == -1 && arc.secondChild == -1) continue;
+        if (arc.firstChild < 0 || arc.firstChild >= a || arc.secondChild < 0 || arc.secondChild >= a) return false;
 
-        if (!found)
+        const HierarchyArc& first = arcs[arc.firstChild];
+        const HierarchyArc& second = arcs[arc.secondChild];
+        if (first.from != arc.from || first.to != second.from || second.to != arc.to ||
+            static_cast<long long>(first.weight) + second.weight != arc.weight)
         {
-            cout << "Area \"" << areaName << "\" not found.\n";
+            return false;
         }
     }
+    return true;
+}
 
-    // Ask the user if they want to display areas again
-    char repeatChoice;
-    cout << "Would you like to display the areas again (y/n)? ";
-    cin >> repeatChoice;
 
-    if (repeatChoice == 'y' || repeatChoice == 'Y') {
-        displayAllAreas(); // Recursively call the function again to display the areas
-    } else {
-        cout << "Returning to main menu.\n";
-    }
-}
-void AreaDatabase::updateAreaData()
+// Reads a hierarchy written by saveContractionHierarchy for the current road network
+bool loadContractionHierarchy(const std::string& filename)
 {
-    if (areas.empty())
+    std::ifstream inFile(filename, std::ios::binary);
+    if (!inFile)
     {
-        cout << "No area data available to update. Please load data first.\n";
-        return;
+        std::cerr << "Error: Unable to open hierarchy file '" << filename << "'.\n";
+        return false;
     }
 
-    string searchName;
-    cout << "\nEnter the area name to update: ";
-    cin.ignore();
-    getline(cin, searchName);
-
-    // Ensure areas are sorted
-    sortAreasByName();
+    char magic[4] = {};
+    std::uint64_t fingerprint = 0;
+    std::int32_t n = 0, m = 0;
+    inFile.read(magic, 4);
+    inFile.read(reinterpret_cast<char*>(&fingerprint), sizeof(fingerprint));
+    inFile.read(reinterpret_cast<char*>(&n), sizeof(n));
+    inFile.read(reinterpret_cast<char*>(&m), sizeof(m));
+    if (!inFile || std::string(magic, 4) != "BWCH" || n < 0 || m < 0)
+    {
+        std::cerr << "Error: '" << filename << "' is not a hierarchy file.\n";
+        return false;
+    }
+    if (fingerprint != networkFingerprint() || n != static_cast<std::int32_t>(areas.size()))
+    {
+        std::cerr << "Error: Hierarchy file '" << filename << "' was built for a different road network.\n";
+        return false;
+    }
 
-    // Perform binary search
-    auto it = lower_bound(areas.begin(), areas.end(), searchName, [](const Area& area, const string& name) {
-        return area.name < name;
-    });
+    // The arc count is checked against the bytes left before anything is allocated
+    std::streamoff start = inFile.tellg();
+    inFile.seekg(0, std::ios::end);
+    std::int64_t left = static_cast<std::int64_t>(inFile.tellg() - start);
+    inFile.seekg(start);
+    if (!inFile || static_cast<std::int64_t>(n) * static_cast<std::int64_t>(sizeof(int)) +
+                       static_cast<std::int64_t>(m) * static_cast<std::int64_t>(sizeof(HierarchyArc)) > left)
+    {
+        std::cerr << "Error: Corrupt hierarchy file '" << filename << "'.\n";
+        return false;
+    }
 
-    if (it == areas.end() || it->name != searchName)
+    std::vector<int> rank(n);
+    std::vector<HierarchyArc> arcs(m);
+    inFile.read(reinterpret_cast<char*>(rank.data()), n * sizeof(int));
+    inFile.read(reinterpret_cast<char*>(arcs.data()), m * sizeof(HierarchyArc));
+    if (!inFile || !validHierarchy(rank, arcs))
     {
-        cout << "Area \"" << searchName << "\" not found.\n";
-        return;
+        std::cerr << "Error: Corrupt hierarchy file '" << filename << "'.\n";
+        return false;
     }
 
-    // Display the current data
-    Area* areaToUpdate = &(*it);
-    cout << "\nCurrent data for \"" << searchName << "\":\n";
-    cout << "Name: " << areaToUpdate->name << "\n";
-    cout << "Address: " << areaToUpdate->address << "\n";
-    cout << "City: " << areaToUpdate->city << "\n";
+    hierarchyRank = std::move(rank);
+    hierarchyArcs = std::move(arcs);
+    buildHierarchySearchGraph();
 
-    // Confirm update
-    char confirmUpdate;
-    cout << "\nDo you want to update this area? (y/n): ";
-    cin >> confirmUpdate;
+    std::cout << "Loaded contraction hierarchy with " << m << " arcs from '" << filename << "'.\n";
+    return true;
+}
 
-    if (confirmUpdate != 'y' && confirmUpdate != 'Y')
+
+// Areas in topological order, or empty if the road network has a cycle
+// (any two-way road is a cycle, so this only succeeds on one-way networks)
+std::vector<int> topologicalOrder()
+{
+    int n = areas.size();
+    std::vector<int> inDegree(n, 0);
+    for (int e = 0; e < static_cast<int>(edgeTargets.size()); e++)
     {
-        cout << "Update cancelled.\n";
-        return;
+        inDegree[edgeTargets[e]]++;
     }
 
-    // Backup current data
-    string oldName = areaToUpdate->name;
-    string oldAddress = areaToUpdate->address;
-    string oldCity = areaToUpdate->city;
-
-    cin.ignore();
-    cout << "Enter new area name (leave blank to keep unchanged): ";
-    string newName;
-    getline(cin, newName);
-    if (!newName.empty())
+    std::vector<int> order;
+    for (int u = 0; u < n; u++)
     {
-        areaToUpdate->name = newName;
+        if (inDegree[u] == 0)
+            order.push_back(u);
     }
 
-    cout << "Enter new address (leave blank to keep unchanged): ";
-    string newAddress;
-    getline(cin, newAddress);
-    if (!newAddress.empty())
+    for (size_t k = 0; k < order.size(); k++)
     {
-        areaToUpdate->address = newAddress;
+        int u = order[k];
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            if (--inDegree[edgeTargets[e]] == 0)
+                order.push_back(edgeTargets[e]);
+        }
     }
 
-    cout << "Enter new city (leave blank to keep unchanged): ";
-    string newCity;
-    getline(cin, newCity);
-    if (!newCity.empty())
-    {
-        areaToUpdate->city = newCity;
-    }
-
-    cout << "Area data updated successfully.\n";
+    if (static_cast<int>(order.size()) != n)
+        order.clear();
+    return order;
+}
 
-    // Log the changes
-    cout << "\nUpdate Summary:\n";
-    cout << "Previous Name: " << oldName << ", New Name: " << areaToUpdate->name << "\n";
-    cout << "Previous Address: " << oldAddress << ", New Address: " << areaToUpdate->address << "\n";
-    cout << "Previous City: " << oldCity << ", New City: " << areaToUpdate->city << "\n";
 
-    // Undo option
-    char undoChoice;
-    cout << "\nWould you like to undo the update? (y/n): ";
-    cin >> undoChoice;
+// Longest path on an acyclic network: relax every road once, in topological order
+std::vector<int> longestPathDag(int source, int destination, const std::vector<int>& order, long long& length)
+{
+    const long long NONE = std::numeric_limits<long long>::min();
+    std::vector<long long> dist(areas.size(), NONE);
+    std::vector<int> parent(areas.size(), -1);
+    dist[source] = 0;
 
-    if (undoChoice == 'y' || undoChoice == 'Y')
+    for (int u : order)
     {
-        areaToUpdate->name = oldName;
-        areaToUpdate->address = oldAddress;
-        areaToUpdate->city = oldCity;
+        if (dist[u] == NONE) continue;
 
-        cout << "Update undone. Data restored to:\n";
-        cout << "Name: " << areaToUpdate->name << "\n";
-        cout << "Address: " << areaToUpdate->address << "\n";
-        cout << "City: " << areaToUpdate->city << "\n";
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            int v = edgeTargets[e];
+            if (dist[u] + edgeWeights[e] > dist[v])
+            {
+                dist[v] = dist[u] + edgeWeights[e];
+                parent[v] = u;
+            }
+        }
     }
 
-    // Ask to update another area
-    char continueChoice;
-    cout << "\nWould you like to update another area? (y/n): ";
-    cin >> continueChoice;
+    std::vector<int> path;
+    if (dist[destination] == NONE)
+        return path;
 
-    if (continueChoice == 'y' || continueChoice == 'Y')
+    length = dist[destination];
+    for (int at = destination; at != -1; at = parent[at])
     {
-        updateAreaData(); // Recursive call
+        path.push_back(at);
     }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
 
 
-    else
-    {
-        cout << "Returning to main menu...\n";
-    }
+// Longest simple path by dynamic programming over the set of areas visited:
+// best[mask][v] is the longest path from source through exactly the areas in mask, ending at v
+// O(2^n * roads) time and O(2^n * n) memory, so only for up to LONGEST_DP_LIMIT areas
+std::vector<int> longestPathBitmask(int source, int destination, long long& length)
+{
+    const int NONE = std::numeric_limits<int>::min();
+    int n = areas.size();
+    std::vector<int> best((static_cast<size_t>(1) << n) * n, NONE);
+    auto at = [&best, n](unsigned mask, int v) -> int& { return best[static_cast<size_t>(mask) * n + v]; };
 
-    // Additional logs or user prompts can be added to expand the code further
-    cout << "End of update process.\n";
-}
+    at(1u << source, source) = 0;
 
-void AreaDatabase::deleteAreaByName()
- {
-    // Step 1: Check if there is any data to delete
-    if (areas.empty())
+    int bestLength = NONE;
+    unsigned bestMask = 0;
+    for (unsigned mask = 0; mask < (1u << n); mask++)
     {
-        cout << "No area data available to delete. Please load data first.\n";
-        return;
+        // Every path starts at source
+        if (!(mask & (1u << source))) continue;
+
+        for (int u = 0; u < n; u++)
+        {
+            int length = at(mask, u);
+            if (length == NONE) continue;
+
+            if (u == destination)
+            {
+                if (length > bestLength)
+                {
+                    bestLength = length;
+                    bestMask = mask;
+                }
+                // A path ending at the destination cannot go on through it
+                continue;
+            }
+
+            for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+            {
+                int v = edgeTargets[e];
+                if (mask & (1u << v)) continue;
+
+                int& next = at(mask | (1u << v), v);
+                next = std::max(next, length + edgeWeights[e]);
+            }
+        }
     }
 
-    // Step 2: Get the name of the area to delete
-    string searchName;
-    cout << "\nEnter the area name to delete: ";
-    cin.ignore(); // Clear input buffer
-    getline(cin, searchName);
+    std::vector<int> path;
+    if (bestLength == NONE)
+        return path;
 
-    // Step 3: Search for the matching areas using linear search
-    vector<int> matchingIndexes;
-    for (size_t i = 0; i < areas.size(); i++)
+    // Walk back: the previous area is the one whose entry plus the road gives this entry
+    length = bestLength;
+    unsigned mask = bestMask;
+    int v = destination;
+    path.push_back(v);
+    while (v != source)
     {
-        if (areas[i].name == searchName)
+        unsigned previousMask = mask & ~(1u << v);
+        int previous = -1;
+        for (int u = 0; u < n && previous == -1; u++)
         {
-            matchingIndexes.push_back(i);
+            if (!(previousMask & (1u << u)) || at(previousMask, u) == NONE) continue;
+
+            for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+            {
+                if (edgeTargets[e] == v && at(previousMask, u) + edgeWeights[e] == at(mask, v))
+                {
+                    previous = u;
+                    break;
+                }
+            }
         }
+        mask = previousMask;
+        v = previous;
+        path.push_back(v);
     }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
 
-    // Step 4: Check if any areas were found
-    if (matchingIndexes.empty())
+
+// Longest simple path by depth-first branch and bound, for up to LONGEST_SEARCH_LIMIT areas
+// A branch is cut when the destination can no longer be reached through unvisited areas, or
+// when even entering every reachable area by its longest road could not beat the best path.
+// Arriving at an area with the same visited set and no longer distance than before is also
+// cut (memoised per area, up to a fixed number of entries).
+// Returns no route and sets exhausted when LONGEST_SEARCH_BUDGET expansions were not enough.
+std::vector<int> longestPathSearch(int source, int destination, long long& length, bool& exhausted)
+{
+    int n = areas.size();
+    const size_t MEMO_LIMIT = 1 << 22;
+
+    std::vector<std::uint64_t> neighbours(n, 0);
+    std::vector<long long> longestInto(n, 0);
+    for (int u = 0; u < n; u++)
     {
-        cout << "No areas found with the name \"" << searchName << "\".\n";
-        return;
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            neighbours[u] |= std::uint64_t(1) << edgeTargets[e];
+            longestInto[edgeTargets[e]] = std::max<long long>(longestInto[edgeTargets[e]], edgeWeights[e]);
+        }
     }
 
-    // Step 5: Display all matching areas
-    cout << "\nMatching areas found:\n";
-
-    cout << left << setw(10) << "Index" << setw(30) << "Name" << setw(50) << "Address" << setw(30) << "City" << "\n";
+    std::vector<std::unordered_map<std::uint64_t, long long>> seen(n);
+    size_t seenEntries = 0;
 
-    cout << string(110, '-') << "\n";
+    long long bestLength = -1;
+    std::vector<int> bestPath;
+    std::vector<int> path = {source};
+    long long expansions = 0;
+    exhausted = false;
 
-    for (size_t i = 0; i < matchingIndexes.size(); i++)
+    std::function<void(int, std::uint64_t, long long)> search = [&](int u, std::uint64_t visited, long long length)
     {
-        int index = matchingIndexes[i];
-        const auto& area = areas[index];
-        cout << left << setw(10) << i + 1 << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << "\n";
-    }
+        if (exhausted || ++expansions > LONGEST_SEARCH_BUDGET)
+        {
+            exhausted = true;
+            return;
+        }
+        if (u == destination)
+        {
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestPath = path;
+            }
+            return;
+        }
 
-    // Step 6: Select the specific area to delete
-    int deleteIndex = 0;
-    if (matchingIndexes.size() > 1)
-    {
-        cout << "\nMultiple matching areas found. Enter the index of the area you want to delete: ";
-        cin >> deleteIndex;
+        // Areas still reachable from u without revisiting
+        std::uint64_t reachable = 0;
+        std::uint64_t frontier = neighbours[u] & ~visited;
+        while (frontier)
+        {
+            reachable |= frontier;
+            std::uint64_t next = 0;
+            for (int v = 0; v < n; v++)
+            {
+                if (frontier & (std::uint64_t(1) << v))
+                    next |= neighbours[v];
+            }
+            frontier = next & ~visited & ~reachable;
+        }
+        if (!(reachable & (std::uint64_t(1) << destination)))
+            return;
 
-        if (deleteIndex < 1 || deleteIndex > (int)matchingIndexes.size())
+        long long bound = length;
+        for (int v = 0; v < n; v++)
         {
-            cout << "Invalid selection. Deletion process cancelled.\n";
+            if (reachable & (std::uint64_t(1) << v))
+                bound += longestInto[v];
+        }
+        if (bound <= bestLength)
             return;
+
+        auto found = seen[u].find(visited);
+        if (found != seen[u].end())
+        {
+            if (found->second >= length)
+                return;
+            found->second = length;
+        }
+        else if (seenEntries < MEMO_LIMIT)
+        {
+            seen[u][visited] = length;
+            seenEntries++;
         }
-        deleteIndex = matchingIndexes[deleteIndex - 1];
-    }
 
-    else
+        // Longest roads first, so a good path is found early and cuts more
+        std::vector<std::pair<int, int>> roads;
+        for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++)
+        {
+            if (!(visited & (std::uint64_t(1) << edgeTargets[e])))
+                roads.push_back({edgeWeights[e], edgeTargets[e]});
+        }
+        std::sort(roads.rbegin(), roads.rend());
+
+        for (const auto& [weight, v] : roads)
+        {
+            path.push_back(v);
+            search(v, visited | (std::uint64_t(1) << v), length + weight);
+            path.pop_back();
+        }
+    };
+
+    search(source, std::uint64_t(1) << source, 0);
+
+    // The best path so far is not known to be the longest
+    if (exhausted)
+        return {};
+    if (bestLength >= 0)
+        length = bestLength;
+    return bestPath;
+}
+
+
+// Longest route from source to destination that never visits an area twice
+// (empty if there is none, or the network is too large to search exactly)
+std::vector<int> longestRoute(int source, int destination, long long& length)
+{
+    std::vector<int> order = topologicalOrder();
+    if (!order.empty())
     {
-        deleteIndex = matchingIndexes[0];
+        return longestPathDag(source, destination, order, length);
     }
 
-    // Step 7: Confirm the deletion
-    const Area& areaToDelete = areas[deleteIndex];
-    cout << "\nYou selected the following area to delete:\n";
+    int n = areas.size();
+    if (n <= LONGEST_DP_LIMIT)
+    {
+        return longestPathBitmask(source, destination, length);
+    }
+    if (n <= LONGEST_SEARCH_LIMIT)
+    {
+        bool exhausted = false;
+        std::vector<int> path = longestPathSearch(source, destination, length, exhausted);
+        if (exhausted)
+        {
+            std::cout << "The road network has too many routes between these areas to find the longest one exactly." << std::endl;
+        }
+        return path;
+    }
 
-    cout << "Name: " << areaToDelete.name << "\n";
+    std::cout << "The road network has " << n << " areas; longest routes are only searched up to "
+              << LONGEST_SEARCH_LIMIT << " areas." << std::endl;
+    return {};
+}
 
-    cout << "Address: " << areaToDelete.address << "\n";
 
-    cout << "City: " << areaToDelete.city << "\n";
+    // Function to validate date format (dd/mm/yyyy), including month lengths and leap years
+  bool isValidDate(const std::string& date)
+{
+    int dayNumber;
+    return parseDate(date, DateFormat::DayMonthYear, dayNumber);
 
-    char confirmDelete;
-    cout << "\nAre you sure you want to delete this area? (y/n): ";
+}
 
-    cin >> confirmDelete;
 
-    if (confirmDelete != 'y' && confirmDelete != 'Y')
+    // Function to allot a vehicle for a waste collection task
+    void allotVehicle(int wasteIndex)
     {
-        cout << "Deletion process cancelled.\n";
-        return;
-    }
 
-    // Step 8: Backup the data for undo
-    Area backupArea = areaToDelete;
+        if (wasteIndex < 0 || wasteIndex >= static_cast<int>(wastes.size()))
+          {
+            std::cout << "Invalid waste index." << std::endl;
+            return;
+        }
 
-    // Step 9: Delete the area
-    areas.erase(areas.begin() + deleteIndex);
-    cout << "\nArea \"" << areaToDelete.name << "\" deleted successfully.\n";
+        std::string date;
+        std::cout << "Enter the date for allotment (dd/mm/yyyy): ";
+        std::cin >> date;
+        while (!isValidDate(date))
+         {
 
-    // Step 10: Offer undo option
-    char undoChoice;
-    cout << "\nWould you like to undo the deletion? (y/n): ";
-    cin >> undoChoice;
+            std::cout << "Invalid date format. Please enter the date in the format dd/mm/yyyy: ";
+            std::cin >> date;
+        }
 
-    if (undoChoice == 'y' || undoChoice == 'Y')
-    {
-        areas.push_back(backupArea);
-        cout << "\nDeletion undone. Area data restored.\n";
+        allotVehicle(wasteIndex, date);
     }
 
 
-    else
+    // Allot a vehicle for an already validated date (no console input, used by batch mode)
+    // Returns true when an allocation was recorded
+    bool allotVehicle(int wasteIndex, const std::string& date)
     {
-        cout << "\nDeletion confirmed.\n";
-    }
 
-    // Step 11: Ask if the user wants to delete another area
-    char continueChoice;
-    cout << "\nWould you like to delete another area? (y/n): ";
-    cin >> continueChoice;
+        if (wasteIndex < 0 || wasteIndex >= static_cast<int>(wastes.size()))
+          {
+            std::cout << "Invalid waste index." << std::endl;
+            return false;
+        }
 
-    if (continueChoice == 'y' || continueChoice == 'Y')
-    {
-        deleteAreaByName(); // Recursive call for another deletion
-    }
+        int requiredCapacity = wastes[wasteIndex].quantity;
+        int source = 0;  // Kanabargi
+        int destination = wastes[wasteIndex].areaId;
 
+        if (destination == -1)
+          {
+            std::cout << "Error: Invalid destination area." << std::endl;
+            return false;
+        }
 
-    else
-    {
-        cout << "\nReturning to the main menu...\n";
-    }
+        // Tightest-fitting free vehicle, so larger trucks stay free for larger piles
+        int vehicleIndex = takeBestFitVehicle(requiredCapacity);
+        if (vehicleIndex == -1)
+          {
+            std::cout << "No suitable vehicle available." << std::endl;
+            return false;
+        }
 
-    // Step 12: Additional log (Optional, extend as needed)
-    cout << "Deletion process completed. Thank you.\n";
+        int driverIndex = takeDriver();
+        if (driverIndex == -1)
+          {
+            releaseVehicle(vehicleIndex);
+            std::cout << "No driver available." << std::endl;
+            return false;
+        }
 
-    // Note: The code can be further expanded by:
-    // 1. Logging each action (e.g., log deleted areas to a file).
-    // 2. Adding additional error checks and validations.
-    // 3. Enhancing the user interface for more detailed prompts.
-}
+        const RouteCache::Entry& cached = cachedShortestPath(source, destination);
+        if (cached.path->empty())
 
+        {
+            // Nothing was dispatched, so hand the vehicle and driver back
+            releaseVehicle(vehicleIndex);
+            releaseDriver(driverIndex);
+            std::cout << "No route found to the destination." << std::endl;
+            return false;
+        }
 
-void AreaDatabase::addNewArea()
-{
-    Area newArea;
-    string confirmation;
-    bool isDuplicate = false;
+        recordAllocation({wasteIndex}, vehicleIndex, driverIndex, *cached.path, cached.distance, date);
+        return true;
+    }
 
-    cout << "=== Add New Area ===\n";
 
-    // Step 1: Input Area Name
-    do
+    // Print a dispatched trip and store it under its date
+    // A trip with several waste piles is a closed collection tour from Kanabargi
+    void recordAllocation(const std::vector<int>& wasteIndexes, int vehicleIndex, int driverIndex,
+                          const std::vector<int>& path, int routeDistance, const std::string& date)
     {
-        cout << "Enter area name: ";
-        cin.ignore();
-        getline(cin, newArea.name);
+        const Vehicle& vehicle = vehicles[vehicleIndex];
+        const Driver& driver = drivers[driverIndex];
 
-        // Validate non-empty input
-        if (newArea.name.empty())
+        std::string wasteAreas;
+        for (size_t k = 0; k < wasteIndexes.size(); k++)
         {
-            cout << "Error: Area name cannot be empty. Please try again.\n";
-            continue;
+            wasteAreas += (k > 0 ? ", " : "") + wastes[wasteIndexes[k]].area;
         }
 
-        // Check for duplicate names
-        isDuplicate = false;
-        for (const auto& area : areas)
+        std::cout << "Vehicle allotted : " << vehicle.vehicleModel << std::endl;
+        std::cout << "  Driver name : " << driver.name << " from " << driver.address
+                  << " for waste in " << wasteAreas << " on " << date << std::endl;
+        std::cout << " Driver address :" << driver.address << std::endl;
+        if (wasteIndexes.size() == 1)
         {
-            if (area.name == newArea.name)
-            {
-                cout << "Error: An area with the name \"" << newArea.name << "\" already exists. Please enter a unique name.\n";
-                isDuplicate = true;
-                break;
-            }
+            std::cout << "Route details from Kanabargi to " << wasteAreas << ":\n";
+        }
+        else
+        {
+            std::cout << "Collection tour from Kanabargi through " << wasteAreas << " and back:\n";
         }
-    } while (newArea.name.empty() || isDuplicate);
 
-    // Step 2: Input Address
-    do {
-        cout << "Enter address: ";
-        getline(cin, newArea.address);
+        for (size_t k = 0; k < path.size(); k++)
+
+        {
+            std::cout << areas[path[k]] << (k + 1 < path.size() ? " -> " : "");
 
-        // Validate non-empty input
-        if (newArea.address.empty()) {
-            cout << "Error: Address cannot be empty. Please try again.\n";
         }
-    } while (newArea.address.empty());
+        std::cout << std::endl;
 
-    // Step 3: Input City
-    do {
-        cout << "Enter city: ";
-        getline(cin, newArea.city);
+        double totalDistance = routeDistance;
+        double travelTime = calculateTravelTime(path, dispatchMinute);
+        int hours = static_cast<int>(travelTime);
+        int minutes = static_cast<int>((travelTime - hours) * 60);
 
-        // Validate non-empty input
-        if (newArea.city.empty()) {
-            cout << "Error: City cannot be empty. Please try again.\n";
+        std::cout << "Total Distance: " << totalDistance << " km\n";
+
+        if (!edgeProfile.empty())
+        {
+            std::cout << "Leaves at " << formatClockTime(dispatchMinute) << ", route done by "
+                      << formatClockTime(dispatchMinute + travelTime * 60) << "." << std::endl;
         }
-    } while (newArea.city.empty());
+        std::cout << "This vehicle will be free in " << hours << " hours and " << minutes << " minutes." << std::endl;
 
-    // Step 4: Confirm the Input
-    cout << "\nPlease review the entered details:\n";
-    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-    cout << left << setw(30) << newArea.name << setw(50) << newArea.address << setw(30) << newArea.city << endl;
+        double fuelRequired = totalDistance / vehicle.mileage;
 
-    do {
-        cout << "Is the information correct? (y/n): ";
-        cin >> confirmation;
+        std::cout << "Fuel Required: " << fuelRequired << " liters\n";
 
-        if (confirmation == "n" || confirmation == "N")
+        std::vector<std::int32_t> stops;
+        for (int wasteIndex : wasteIndexes)
         {
-            cout << "Operation cancelled. Returning to menu.\n";
-            return;
+            stops.push_back(allocationStrings.intern(wastes[wasteIndex].area));
         }
 
-        else if (confirmation != "y" && confirmation != "Y")
+        int day = dateToDayNumber(date);
+        std::vector<AllocationDetail>& details = allocations[day];
+        details.push_back({allocationStrings.intern(vehicle.vehicleModel), allocationStrings.intern(driver.name),
+                           allocationStrings.intern(wasteAreas), routeArena.add(internRoute(path)),
+                           routeArena.add(stops), vehicleIndex, fuelRequired});
+        indexAllocation(day, static_cast<int>(details.size()) - 1);
+        fuelLedger.add(day, details.back(), routeArena);
+        logAllocation(day, static_cast<int>(details.size()) - 1);
+
+        for (int wasteIndex : wasteIndexes)
         {
-            cout << "Invalid input. Please enter 'y' or 'n'.\n";
+            wastes[wasteIndex].isAllotted = true;
         }
-    } while (confirmation != "y" && confirmation != "Y");
 
-    // Step 5: Add to the Area List
-    areas.push_back(newArea);
-    cout << "\nArea data added successfully.\n";
-
-    // Step 6: Log the New Area Addition
-    cout << "Logging the new area addition...\n";
-    // Example log statement - Replace with actual file or database logging
-    cout << "Log: New area \"" << newArea.name << "\" in \"" << newArea.city << "\" added.\n";
+        std::cout << " =========================================================" << std::endl;
+    }
 
-    // Step 7: Offer to Add Another Area
-    char addAnother;
-    cout << "\nWould you like to add another area? (y/n): ";
-    cin >> addAnother;
 
-    if (addAnother == 'y' || addAnother == 'Y')
+    // Take a specific free vehicle out of the pool (used when the assignment is
+    // decided for all piles at once rather than by best fit)
+    void takeVehicle(int index)
     {
-        addNewArea();  // Recursive call to add another area
+        auto it = freeVehicles.find({vehicles[index].loadCapacity, index});
+        if (it != freeVehicles.end())
+            freeVehicles.erase(it);
+        vehicles[index].isAllotted = true;
     }
 
-    else
-    {
-        cout << "Returning to the main menu...\n";
-    }
-}
 
-    void AreaDatabase::saveToFile() const {
-    if (areas.empty())
+    // Minimum-cost assignment of every row to a distinct column (Hungarian method,
+    // O(rows^2 * columns)); requires rows <= columns
+    // Returns the column chosen for each row
+    std::vector<int> minCostAssignment(const std::vector<std::vector<double>>& cost)
     {
-        cout << "No area data to save. Please add data before saving.\n";
-        return;
-    }
-
-    string filename;
-    string confirmation;
-    ofstream file;
+        int n = cost.size();
+        int m = n > 0 ? cost[0].size() : 0;
+        const double INF = std::numeric_limits<double>::infinity();
 
-    // Step 1: Input Filename
-    do {
-        cout << "Enter the filename to save area data to: ";
-        cin >> filename;
+        // Potentials and matching are 1-based, column 0 is a virtual start
+        std::vector<double> u(n + 1, 0.0), v(m + 1, 0.0);
+        std::vector<int> rowOf(m + 1, 0), way(m + 1, 0);
 
-        // Confirm overwriting existing file
-        ifstream checkFile(filename);
-        if (checkFile)
+        for (int i = 1; i <= n; i++)
         {
-            cout << "Warning: File \"" << filename << "\" already exists. Overwriting will replace its content.\n";
-            cout << "Do you want to proceed? (y/n): ";
-            cin >> confirmation;
+            rowOf[0] = i;
+            int j0 = 0;
+            std::vector<double> minv(m + 1, INF);
+            std::vector<bool> used(m + 1, false);
 
-            if (confirmation == "n" || confirmation == "N")
+            do
             {
-                cout << "Operation cancelled. Returning to menu.\n";
-                return;
-            }
+                used[j0] = true;
+                int i0 = rowOf[j0];
+                int j1 = 0;
+                double delta = INF;
 
-            else if (confirmation != "y" && confirmation != "Y")
+                for (int j = 1; j <= m; j++)
+                {
+                    if (used[j])
+                        continue;
+
+                    double reduced = cost[i0 - 1][j - 1] - u[i0] - v[j];
+                    if (reduced < minv[j])
+                    {
+                        minv[j] = reduced;
+                        way[j] = j0;
+                    }
+                    if (minv[j] < delta)
+                    {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+
+                for (int j = 0; j <= m; j++)
+                {
+                    if (used[j])
+                    {
+                        u[rowOf[j]] += delta;
+                        v[j] -= delta;
+                    }
+                    else
+                    {
+                        minv[j] -= delta;
+                    }
+                }
+                j0 = j1;
+            } while (rowOf[j0] != 0);
+
+            // Flip the augmenting path
+            do
             {
-                cout << "Invalid input. Please enter 'y' or 'n'.\n";
-                checkFile.close();
-                continue;
-            }
+                int j1 = way[j0];
+                rowOf[j0] = rowOf[j1];
+                j0 = j1;
+            } while (j0 != 0);
         }
-        checkFile.close();
 
-        // Attempt to open the file for writing
-        file.open(filename, ios::out | ios::trunc);
-        if (!file)
+        std::vector<int> columnOf(n, -1);
+        for (int j = 1; j <= m; j++)
         {
-            cout << "Error: Could not open file \"" << filename << "\" for writing. Please try again.\n";
+            if (rowOf[j] != 0)
+                columnOf[rowOf[j] - 1] = j - 1;
         }
-    } while (!file);
-
-    // Step 2: Save Data to File
-    cout << "Saving area data to \"" << filename << "\"...\n";
-    for (const auto& area : areas)
-    {
-        file << area.name << "," << area.address << "," << area.city << endl;
-
-        // Optional: Log each record saved
-        cout << "Log: Saved area \"" << area.name << "\" to file.\n";
+        return columnOf;
     }
-    file.close();
-    cout << "Area data successfully saved to file \"" << filename << "\".\n";
 
-    // Step 3: Backup Option
-    char createBackup;
-    cout << "Would you like to create a backup of this file? (y/n): ";
-    cin >> createBackup;
 
-    if (createBackup == 'y' || createBackup == 'Y')
+    // Choose which trips get a vehicle and match them to the free vehicles
+    // Trips are taken largest load first with the tightest free vehicle, as many as there
+    // are free drivers; a vehicle that fits a load also fits every smaller one, so this
+    // serves the most trips. The served trips are then matched to vehicles by fuel used.
+    // Returns the vehicle for each trip, or -1 if the trip could not be served
+    std::vector<int> assignFreeVehicles(const std::vector<int>& loads, const std::vector<double>& distances)
     {
-        string backupFilename = filename + ".bak";
-        ifstream sourceFile(filename, ios::binary);
-        ofstream backupFile(backupFilename, ios::binary);
+        std::vector<int> order(loads.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&loads](int a, int b)
+        {
+            return loads[a] > loads[b];
+        });
 
-        if (sourceFile && backupFile)
+        std::multiset<std::pair<int, int>> capacityLeft = freeVehicles;
+        size_t driversLeft = freeDrivers.size();
+        std::vector<int> served;
+        for (int trip : order)
         {
-            backupFile << sourceFile.rdbuf();
-            sourceFile.close();
-            backupFile.close();
-            cout << "Backup file \"" << backupFilename << "\" created successfully.\n";
+            if (served.size() == driversLeft)
+                break;
+
+            auto it = capacityLeft.lower_bound({loads[trip], -1});
+            if (it == capacityLeft.end())
+                continue;
+
+            capacityLeft.erase(it);
+            served.push_back(trip);
         }
 
-        else
+        // Cheapest matching of the served trips to the free vehicles, fuel = distance / mileage
+        std::vector<int> candidates;
+        for (const auto& entry : freeVehicles)
         {
-            cout << "Error: Unable to create backup file \"" << backupFilename << "\".\n";
+            candidates.push_back(entry.second);
         }
-    }
-
-}
 
-    void AreaDatabase::enterPopulationData()
-    {
-    int count;
-    cout << "Enter the number of areas for which you want to provide population data: ";
+        const double NOT_ALLOWED = 1e12;
+        std::vector<std::vector<double>> cost(served.size(), std::vector<double>(candidates.size()));
+        for (size_t r = 0; r < served.size(); r++)
+        {
+            for (size_t c = 0; c < candidates.size(); c++)
+            {
+                const Vehicle& vehicle = vehicles[candidates[c]];
+                cost[r][c] = vehicle.loadCapacity >= loads[served[r]]
+                             ? distances[served[r]] / vehicle.mileage
+                             : NOT_ALLOWED;
+            }
+        }
+        std::vector<int> match = minCostAssignment(cost);
 
-    // Input validation for count
-    while (true) {
-        cin >> count;
-        if (count > 0) break;
-        else {
-            cout << "Invalid number. Please enter a positive integer: ";
+        std::vector<int> vehicleOf(loads.size(), -1);
+        for (size_t r = 0; r < served.size(); r++)
+        {
+            vehicleOf[served[r]] = candidates[match[r]];
         }
+        return vehicleOf;
     }
 
-    populationData.clear();
 
-    for (int i = 0; i < count; ++i)
+    // Allot every pending waste pile for one date in a single pass, one pile per vehicle
+    // Returns the number of piles allotted
+    int allotAllWastes(const std::string& date)
     {
-        string areaName;
-        double population;
-        char editOption;
-
-        cout << "\nEnter area name #" << (i + 1) << ": ";
-        cin.ignore();
-        getline(cin, areaName);
+        int source = 0;  // Kanabargi
+        if (areas.empty())
+        {
+            std::cout << "No road network loaded." << std::endl;
+            return 0;
+        }
 
-        // Remove any extra spaces from the area name
-        areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
+        // One shortest-path tree from Kanabargi serves every pile
+        std::vector<int> parent;
+        std::vector<int> distance = dijkstra(source, source, parent);
 
-        // Input validation for population
-        while (true) {
-            cout << "Enter population for " << areaName << ": ";
-            cin >> population;
-            if (population >= 0) break;
+        // Piles that can be routed, and (waste index, reason) for every pile that is not allotted
+        std::vector<int> pending;
+        std::vector<int> loads;
+        std::vector<double> tripDistance;
+        std::vector<std::pair<int, const char*>> notAllotted;
+        int pendingCount = 0;
+        for (int i = 0; i < static_cast<int>(wastes.size()); i++)
+        {
+            if (wastes[i].isAllotted)
+                continue;
 
+            pendingCount++;
+            int areaId = wastes[i].areaId;
+            if (areaId == -1)
+            {
+                notAllotted.push_back({i, "unknown area"});
+            }
+            else if (distance[areaId] == std::numeric_limits<int>::max())
+            {
+                notAllotted.push_back({i, "unreachable from Kanabargi"});
+            }
             else
             {
-                cout << "Population cannot be negative. Please enter a valid population: ";
+                pending.push_back(i);
+                loads.push_back(wastes[i].quantity);
+                tripDistance.push_back(distance[areaId]);
             }
         }
 
-        // Check if the area name already exists in the population data
-        auto it = populationData.find(areaName);
+        std::vector<int> vehicleOf = assignFreeVehicles(loads, tripDistance);
 
-        if (it != populationData.end())
+        int allotted = 0;
+        double totalDistance = 0.0;
+        double totalFuel = 0.0;
+        for (size_t k = 0; k < pending.size(); k++)
         {
-            cout << "Population data already exists for \"" << areaName << "\". Do you want to update it? (y/n): ";
-            cin >> editOption;
-
-            // If user wants to update existing data
-            if (editOption == 'y' || editOption == 'Y')
+            int wasteIndex = pending[k];
+            int vehicleIndex = vehicleOf[k];
+            if (vehicleIndex == -1)
             {
-                populationData[areaName] = population;
-                cout << "Population data for \"" << areaName << "\" updated successfully.\n";
+                notAllotted.push_back({wasteIndex, "no free vehicle or driver"});
+                continue;
             }
 
-             else
+            int areaId = wastes[wasteIndex].areaId;
+            std::vector<int> path;
+            for (int at = areaId; at != -1; at = parent[at])
             {
-                cout << "Population data for \"" << areaName << "\" not changed.\n";
+                path.push_back(at);
             }
-        }
-         else
-        {
-            // Otherwise, add the new data
-            populationData[areaName] = population;
-            cout << "Population data for \"" << areaName << "\" added successfully.\n";
-        }
+            std::reverse(path.begin(), path.end());
 
-        // Ask if user wants to add more population data
-        char addMore;
-        cout << "\nDo you want to add population data for another area? (y/n): ";
-        cin >> addMore;
+            takeVehicle(vehicleIndex);
+            int driverIndex = takeDriver();
+            recordAllocation({wasteIndex}, vehicleIndex, driverIndex, path, distance[areaId], date);
 
-        if (addMore == 'n' || addMore == 'N')
-        {
-            break; // Exit the loop if user does not want to add more data
+            allotted++;
+            totalDistance += distance[areaId];
+            totalFuel += distance[areaId] / vehicles[vehicleIndex].mileage;
         }
 
-        else if (addMore != 'y' && addMore != 'Y')
+        std::cout << "Allotted " << allotted << " of " << pendingCount << " pending waste piles on " << date
+                  << " (" << totalDistance << " km, " << totalFuel << " liters)" << std::endl;
+        std::sort(notAllotted.begin(), notAllotted.end());
+        for (const auto& [wasteIndex, reason] : notAllotted)
         {
-            cout << "Invalid input. Please enter 'y' for yes or 'n' for no.\n";
-            // Keep asking until valid input
-            while (true) {
-                cout << "\nDo you want to add population data for another area? (y/n): ";
-                cin >> addMore;
-                if (addMore == 'y' || addMore == 'Y') break;
-                else if (addMore == 'n' || addMore == 'N') break;
-
-                else
-                {
-                    cout << "Invalid input. Please enter 'y' for yes or 'n' for no.\n";
-                }
-            }
+            std::cout << "  Not allotted: waste in " << wastes[wasteIndex].area << " (" << wastes[wasteIndex].quantity
+                      << " kg), " << reason << std::endl;
         }
+
+        return allotted;
     }
 
-    // Ask the user if they want to save the population data to a file
-    char saveOption;
-    cout << "\nWould you like to save the population data to a file? (y/n): ";
-    cin >> saveOption;
 
-    if (saveOption == 'y' || saveOption == 'Y')
+    // Shortest distances from one area to every area (INT_MAX when unreachable), taken
+    // from the all-pairs table when it is available, otherwise from one Dijkstra run
+    std::vector<int> distancesFrom(int source)
     {
-        string filename;
-        ofstream file;
-
-        // Step 1: Get filename from user
-        cout << "Enter filename to save population data: ";
-        cin >> filename;
-
-        file.open(filename, ios::out | ios::trunc);
-
-        // Step 2: Check if file is opened successfully
-        if (!file)
+        if (allPairsVersion != graphVersion)
         {
-            cout << "Error: Could not open file for saving population data. Please check the file path and try again.\n";
-            return;
+            buildAllPairsShortestPaths();
         }
-
-        // Step 3: Save data to the file
-        cout << "Saving population data to \"" << filename << "\"...\n";
-        file << "Area Name, Population\n"; // Header
-
-        for (const auto& entry : populationData)
+        if (!allPairsDistance.empty())
         {
-            file << entry.first << "," << entry.second << endl;
-            cout << "Log: Saved population data for \"" << entry.first << "\" to file.\n";
+            return allPairsDistance[source];
         }
 
-        file.close();
-        cout << "Population data successfully saved to \"" << filename << "\".\n";
+        std::vector<int> parent;
+        return dijkstra(source, source, parent);
     }
 
-    // Step 4: Provide options for editing or deleting entries
-    char editDeleteOption;
-    cout << "\nWould you like to edit or delete any population data? (e/d/n): ";
-    cin >> editDeleteOption;
 
-    if (editDeleteOption == 'e' || editDeleteOption == 'E')
+    // Length of a closed tour over the planning matrix, where index 0 is Kanabargi
+    static long long tourLength(const std::vector<int>& stops, const std::vector<std::vector<long long>>& dist)
     {
-        string editAreaName;
-        cout << "Enter the area name to edit: ";
-        cin.ignore();
-        getline(cin, editAreaName);
-
-        auto it = populationData.find(editAreaName);
-        if (it != populationData.end())
-        {
-            double newPopulation;
-            cout << "Enter the new population for \"" << editAreaName << "\": ";
-            cin >> newPopulation;
-            it->second = newPopulation;
-            cout << "Population for \"" << editAreaName << "\" updated successfully.\n";
-        }
+        if (stops.empty())
+            return 0;
 
-        else
+        long long total = dist[0][stops.front()] + dist[stops.back()][0];
+        for (size_t k = 1; k < stops.size(); k++)
         {
-            cout << "Area \"" << editAreaName << "\" not found in the population data.\n";
+            total += dist[stops[k - 1]][stops[k]];
         }
-
+        return total;
     }
-     else if (editDeleteOption == 'd' || editDeleteOption == 'D') {
-        string deleteAreaName;
-        cout << "Enter the area name to delete: ";
-        cin.ignore();
-        getline(cin, deleteAreaName);
-
-        auto it = populationData.find(deleteAreaName);
-        if (it != populationData.end())
-        {
-            populationData.erase(it);
-            cout << "Population data for \"" << deleteAreaName << "\" deleted successfully.\n";
-        }
 
-        else
-        {
-            cout << "Area \"" << deleteAreaName << "\" not found in the population data.\n";
-        }
-    }
 
-     else if (editDeleteOption != 'n' && editDeleteOption != 'N')
+    // Local search on a set of tours: 2-opt inside each tour, then moving single stops
+    // to the cheapest place in another tour with room, until neither helps
+    // Tour t must stay within capacity[t]
+    static void improveTours(std::vector<std::vector<int>>& tours, const std::vector<std::vector<long long>>& dist,
+                             const std::vector<int>& load, const std::vector<int>& capacity)
     {
-        cout << "Invalid option. Please enter 'e' for edit, 'd' for delete, or 'n' for none.\n";
-    }
+        bool improved = true;
+        while (improved)
+        {
+            improved = false;
 
-    cout << "\nPopulation data successfully entered and processed.\n";
-}
-void AreaDatabase::calculateWasteGeneration() const {
-    // Average waste generation rate in kg per person per day
-    double wastePerCapita = 0.74;
+            for (auto& tour : tours)
+            {
+                long long best = tourLength(tour, dist);
+                for (size_t i = 0; i + 1 < tour.size(); i++)
+                {
+                    for (size_t j = i + 1; j < tour.size(); j++)
+                    {
+                        // Roads may be one-way, so the reversed segment is re-measured in full
+                        std::reverse(tour.begin() + i, tour.begin() + j + 1);
+                        long long length = tourLength(tour, dist);
+                        if (length < best)
+                        {
+                            best = length;
+                            improved = true;
+                        }
+                        else
+                        {
+                            std::reverse(tour.begin() + i, tour.begin() + j + 1);
+                        }
+                    }
+                }
+            }
 
-    // Input validation for custom waste per capita rate
-    char customRateOption;
-    cout << "Do you want to input a custom waste generation rate? (y/n): ";
-    cin >> customRateOption;
+            std::vector<int> tourLoad(tours.size(), 0);
+            for (size_t t = 0; t < tours.size(); t++)
+            {
+                for (int stop : tours[t])
+                {
+                    tourLoad[t] += load[stop];
+                }
+            }
 
-    if (customRateOption == 'y' || customRateOption == 'Y')
-    {
-        cout << "Enter the waste generation rate in kg per person per day: ";
-        cin >> wastePerCapita;
+            for (size_t a = 0; a < tours.size(); a++)
+            {
+                for (size_t p = 0; p < tours[a].size(); p++)
+                {
+                    int stop = tours[a][p];
+                    int before = p > 0 ? tours[a][p - 1] : 0;
+                    int after = p + 1 < tours[a].size() ? tours[a][p + 1] : 0;
+                    long long removeGain = dist[before][stop] + dist[stop][after] - dist[before][after];
+
+                    long long bestGain = 0;
+                    size_t bestTour = a;
+                    size_t bestPosition = 0;
+                    for (size_t b = 0; b < tours.size(); b++)
+                    {
+                        if (b == a || tourLoad[b] + load[stop] > capacity[b])
+                            continue;
 
-        // Validate the input rate
-        while (wastePerCapita <= 0) {
-            cout << "Invalid input. Waste generation rate must be greater than 0. Please try again: ";
-            cin >> wastePerCapita;
+                        for (size_t q = 0; q <= tours[b].size(); q++)
+                        {
+                            int x = q > 0 ? tours[b][q - 1] : 0;
+                            int y = q < tours[b].size() ? tours[b][q] : 0;
+                            long long gain = removeGain - (dist[x][stop] + dist[stop][y] - dist[x][y]);
+                            if (gain > bestGain)
+                            {
+                                bestGain = gain;
+                                bestTour = b;
+                                bestPosition = q;
+                            }
+                        }
+                    }
+
+                    if (bestTour != a)
+                    {
+                        tours[a].erase(tours[a].begin() + p);
+                        tours[bestTour].insert(tours[bestTour].begin() + bestPosition, stop);
+                        tourLoad[a] -= load[stop];
+                        tourLoad[bestTour] += load[stop];
+                        improved = true;
+                        p--;
+                    }
+                }
+            }
         }
-        cout << "Custom waste generation rate set to " << wastePerCapita << " kg/day.\n";
     }
 
-    if (populationData.empty())
-    {
-        cout << "No population data available. Please load population data first.\n";
-        return;
-    }
 
-    if (areas.empty())
+    // Plan one tour per vehicle over the planning matrix (index 0 is Kanabargi)
+    // Vehicles are filled in the order given: for each one,
+    // Clarke-Wright savings joins the end of one tour to the start of another in order of
+    // the distance saved while the load fits, and the vehicle takes the fullest tour.
+    // Stops left over are then inserted wherever there is room, followed by local search.
+    // Seed 0 is the plain heuristic; other seeds perturb the savings for multi-start.
+    static std::vector<std::vector<int>> planTours(const std::vector<std::vector<long long>>& dist,
+                                                   const std::vector<int>& load, const std::vector<int>& capacity,
+                                                   unsigned seed)
     {
-        cout << "No area data available. Please load area data first.\n";
-        return;
-    }
+        int n = static_cast<int>(dist.size()) - 1;
 
-    // Displaying header for waste calculation
-    cout << left << setw(30) << "Area Name"
-         << setw(50) << "Address"
-         << setw(30) << "City"
-         << setw(20) << "Population"
-         << setw(20) << "Waste (kg/day)"
-         << setw(20) << "Waste (kg/year)"
-         << setw(20) << "Notes" << endl;
+        struct Saving
+        {
+            double value;
+            int from;
+            int to;
+        };
 
-    cout << string(170, '-') << endl;
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> noise(0.0, 0.2);
+        std::vector<Saving> savings;
+        for (int i = 1; i <= n; i++)
+        {
+            for (int j = 1; j <= n; j++)
+            {
+                if (i == j)
+                    continue;
 
-    // Calculate waste for each area
-    for (const auto& area : areas)
-    {
-        string areaName = area.name;
-        areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
+                long long saved = dist[i][0] + dist[0][j] - dist[i][j];
+                if (saved > 0)
+                {
+                    savings.push_back({seed == 0 ? saved : saved * (1.0 + noise(rng)), i, j});
+                }
+            }
+        }
+        std::sort(savings.begin(), savings.end(), [](const Saving& a, const Saving& b)
+        {
+            return a.value > b.value;
+        });
 
-        auto it = populationData.find(areaName);
+        std::vector<std::vector<int>> tours(capacity.size());
+        std::vector<bool> routed(n + 1, false);
+        std::vector<int> head(n + 1), tail(n + 1), chainLoad(n + 1), next(n + 1);
 
-        if (it != populationData.end())
+        for (size_t t = 0; t < capacity.size(); t++)
         {
-            double population = it->second;
-            double totalWastePerDay = population * wastePerCapita;
-            double totalWastePerYear = totalWastePerDay * 365;
+            // Every stop that is still free and fits starts as its own chain, identified by its head
+            for (int i = 1; i <= n; i++)
+            {
+                head[i] = i;
+                tail[i] = i;
+                chainLoad[i] = load[i];
+                next[i] = 0;
+            }
 
-            // Check if the waste generation rate is too high or too low
-            string notes;
+            for (const Saving& saving : savings)
+            {
+                int a = saving.from;
+                int b = saving.to;
+                if (routed[a] || routed[b] || load[a] > capacity[t] || load[b] > capacity[t])
+                    continue;
+
+                int headA = head[a];
+                int headB = head[b];
+                if (headA == headB || tail[headA] != a || headB != b ||
+                    chainLoad[headA] + chainLoad[headB] > capacity[t])
+                    continue;
+
+                next[a] = b;
+                tail[headA] = tail[headB];
+                chainLoad[headA] += chainLoad[headB];
+                for (int at = b; at != 0; at = next[at])
+                {
+                    head[at] = headA;
+                }
+            }
 
-            if (totalWastePerDay < 100)
+            int best = 0;
+            for (int i = 1; i <= n; i++)
             {
-                notes = "Unrealistic low waste generation.";
+                if (!routed[i] && head[i] == i && load[i] <= capacity[t] &&
+                    (best == 0 || chainLoad[i] > chainLoad[best]))
+                {
+                    best = i;
+                }
             }
+            if (best == 0)
+                continue;
 
-            else if (totalWastePerDay > 10000)
+            for (int at = best; at != 0; at = next[at])
             {
-                notes = "Unrealistic high waste generation.";
+                tours[t].push_back(at);
+                routed[at] = true;
             }
+        }
 
-            else
+        // Insertion: put each stop left over where it adds the least distance
+        std::vector<int> tourLoad(tours.size(), 0);
+        for (size_t t = 0; t < tours.size(); t++)
+        {
+            for (int stop : tours[t])
             {
-                notes = "Normal waste generation.";
+                tourLoad[t] += load[stop];
             }
+        }
+        for (int stop = 1; stop <= n; stop++)
+        {
+            if (routed[stop])
+                continue;
 
-            // Output detailed information for the area
-            cout << left << setw(30) << area.name
-                 << setw(50) << area.address
-                 << setw(30) << area.city
-                 << setw(20) << population
-                 << setw(20) << totalWastePerDay
-                 << setw(20) << totalWastePerYear
-                 << setw(20) << notes << endl;
+            long long bestIncrease = std::numeric_limits<long long>::max();
+            size_t bestTour = tours.size();
+            size_t bestPosition = 0;
+            for (size_t t = 0; t < tours.size(); t++)
+            {
+                if (tourLoad[t] + load[stop] > capacity[t])
+                    continue;
 
-        }
+                for (size_t q = 0; q <= tours[t].size(); q++)
+                {
+                    int x = q > 0 ? tours[t][q - 1] : 0;
+                    int y = q < tours[t].size() ? tours[t][q] : 0;
+                    long long increase = dist[x][stop] + dist[stop][y] - dist[x][y];
+                    if (increase < bestIncrease)
+                    {
+                        bestIncrease = increase;
+                        bestTour = t;
+                        bestPosition = q;
+                    }
+                }
+            }
+            if (bestTour == tours.size())
+                continue;
 
-        else
-        {
-            // No population data found for the area
-            cout << left << setw(30) << area.name
-                 << setw(50) << area.address
-                 << setw(30) << area.city
-                 << setw(20) << "No data"
-                 << setw(20) << "No data"
-                 << setw(20) << "No data"
-                 << setw(20) << "No population data" << endl;
+            tours[bestTour].insert(tours[bestTour].begin() + bestPosition, stop);
+            tourLoad[bestTour] += load[stop];
+            routed[stop] = true;
         }
+
+        improveTours(tours, dist, load, capacity);
+        return tours;
     }
 
-    // Provide additional information about the calculation
-    char furtherActionOption;
-    cout << "\nWould you like to perform additional actions on the waste generation data? (y/n): ";
-    cin >> furtherActionOption;
 
-    if (furtherActionOption == 'y' || furtherActionOption == 'Y')
+    // Run planTours from several seeds across the available cores and keep the plan that
+    // collects the most waste, then the shortest one
+    // The result depends only on the number of starts, not on the number of threads
+    static std::vector<std::vector<int>> planToursMultiStart(const std::vector<std::vector<long long>>& dist,
+                                                             const std::vector<int>& load,
+                                                             const std::vector<int>& capacity, int starts)
     {
-        // Let the user choose an action: filter data, calculate summary, etc.
-        char actionChoice;
-        cout << "Choose an action:\n";
-        cout << "1. View summary of total waste\n";
-        cout << "2. View areas with excessive waste generation\n";
-        cout << "3. Export data to file\n";
-        cout << "Enter choice (1-3): ";
-        cin >> actionChoice;
+        starts = std::max(1, starts);
+        if (starts > TOUR_STARTS_LIMIT)
+            starts = TOUR_STARTS_LIMIT;
+        int threadCount = std::min(starts, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
 
-        if (actionChoice == '1')
+        std::vector<std::vector<std::vector<int>>> plans(starts);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threadCount; t++)
         {
-            // Calculate the total waste generation for all areas
-            double totalWaste = 0.0;
-            for (const auto& area : areas)
+            workers.emplace_back([&, t]()
             {
-                string areaName = area.name;
-                areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
-
-                auto it = populationData.find(areaName);
-                if (it != populationData.end())
+                for (int start = t; start < starts; start += threadCount)
                 {
-                    double population = it->second;
-                    totalWaste += population * wastePerCapita;
+                    plans[start] = planTours(dist, load, capacity, start);
                 }
-            }
-            cout << "Total waste generation for all areas (kg/day): " << totalWaste << endl;
+            });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
         }
 
-         else if (actionChoice == '2')
+        int best = 0;
+        long long bestLoad = -1;
+        long long bestLength = 0;
+        for (int start = 0; start < starts; start++)
         {
-            // Filter areas with excessive waste generation (more than 1000 kg/day)
-            cout << "\nAreas with excessive waste generation (more than 1000 kg/day):\n";
-            for (const auto& area : areas)
+            long long collected = 0;
+            long long length = 0;
+            for (const auto& tour : plans[start])
             {
-                string areaName = area.name;
-                areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
-
-                auto it = populationData.find(areaName);
-                if (it != populationData.end())
+                for (int stop : tour)
                 {
-                    double population = it->second;
-                    double totalWastePerDay = population * wastePerCapita;
-                    if (totalWastePerDay > 1000)
-                    {
-                        cout << area.name << " (" << totalWastePerDay << " kg/day)\n";
-                    }
+                    collected += load[stop];
                 }
+                length += tourLength(tour, dist);
+            }
+            if (collected > bestLoad || (collected == bestLoad && length < bestLength))
+            {
+                bestLoad = collected;
+                bestLength = length;
+                best = start;
             }
         }
+        return plans[best];
+    }
 
-        else if (actionChoice == '3')
+
+    // Allot the pending waste piles for one date as multi-stop collection tours, so a
+    // vehicle with spare capacity picks up several piles before returning to Kanabargi
+    // Returns the number of piles allotted
+    int allotCollectionTours(const std::string& date, int starts)
+    {
+        const int INF = std::numeric_limits<int>::max();
+        const long long UNREACHABLE = 1000000000000LL;
+        int depot = 0;  // Kanabargi
+        if (areas.empty())
         {
-            // Export data to a file
-            string filename;
-            cout << "Enter filename to save the waste data: ";
-            cin >> filename;
-            ofstream file(filename);
+            std::cout << "No road network loaded." << std::endl;
+            return 0;
+        }
 
-            if (!file)
+        // One shortest-path computation per distinct area involved
+        std::unordered_map<int, std::vector<int>> fromArea;
+        fromArea[depot] = distancesFrom(depot);
+
+        // One tour for each of the largest free vehicles there are drivers for
+        std::vector<int> capacity;
+        for (auto it = freeVehicles.rbegin(); it != freeVehicles.rend() && capacity.size() < freeDrivers.size(); ++it)
+        {
+            capacity.push_back(it->first);
+        }
+        // Fill the smallest of them first, keeping the large vehicles for the large piles
+        std::reverse(capacity.begin(), capacity.end());
+        int largest = capacity.empty() ? 0 : capacity.back();
+        std::vector<int> pending;
+        // (waste index, reason) for every pile that is not allotted
+        std::vector<std::pair<int, const char*>> notAllotted;
+        for (int i = 0; i < static_cast<int>(wastes.size()); i++)
+        {
+            int areaId = wastes[i].areaId;
+            if (wastes[i].isAllotted)
+                continue;
+            if (areaId == -1)
             {
-                cout << "Error: Could not open file for writing. Please check the file path.\n";
-                return;
+                notAllotted.push_back({i, "unknown area"});
+                continue;
             }
 
-            file << "Area Name, Address, City, Population, Waste (kg/day), Waste (kg/year), Notes\n";
-            for (const auto& area : areas)
+            if (fromArea.find(areaId) == fromArea.end())
+            {
+                fromArea[areaId] = distancesFrom(areaId);
+            }
+            if (fromArea[depot][areaId] == INF || fromArea[areaId][depot] == INF)
+            {
+                notAllotted.push_back({i, "no round trip from Kanabargi"});
+                continue;
+            }
+            if (wastes[i].quantity > largest)
             {
-                string areaName = area.name;
-                areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
+                notAllotted.push_back({i, "no free vehicle or driver large enough"});
+                continue;
+            }
+            pending.push_back(i);
+        }
 
-                auto it = populationData.find(areaName);
+        // Planning matrix: index 0 is Kanabargi, index k is pending[k - 1]
+        int n = pending.size();
+        std::vector<int> stopArea(n + 1, depot);
+        std::vector<int> load(n + 1, 0);
+        for (int k = 1; k <= n; k++)
+        {
+            stopArea[k] = wastes[pending[k - 1]].areaId;
+            load[k] = wastes[pending[k - 1]].quantity;
+        }
 
-                if (it != populationData.end())
-                {
-                    double population = it->second;
-                    double totalWastePerDay = population * wastePerCapita;
-                    double totalWastePerYear = totalWastePerDay * 365;
-                    string notes;
+        std::vector<std::vector<long long>> dist(n + 1, std::vector<long long>(n + 1));
+        for (int a = 0; a <= n; a++)
+        {
+            const std::vector<int>& row = fromArea[stopArea[a]];
+            for (int b = 0; b <= n; b++)
+            {
+                dist[a][b] = row[stopArea[b]] == INF ? UNREACHABLE : row[stopArea[b]];
+            }
+        }
 
-                    if (totalWastePerDay < 100)
-                    {
-                        notes = "Unrealistic low waste generation.";
-                    }
+        std::vector<std::vector<int>> tours;
+        if (n > 0)
+        {
+            tours = planToursMultiStart(dist, load, capacity, starts);
+        }
 
-                    else if (totalWastePerDay > 10000)
-                    {
-                        notes = "Unrealistic high waste generation.";
-                    }
+        // Piles that no tour could take
+        std::vector<bool> inTour(n + 1, false);
+        for (const auto& tour : tours)
+        {
+            for (int stop : tour)
+            {
+                inTour[stop] = true;
+            }
+        }
+        for (int k = 1; k <= n; k++)
+        {
+            if (!inTour[k])
+            {
+                notAllotted.push_back({pending[k - 1], "no free vehicle or driver"});
+            }
+        }
+        tours.erase(std::remove_if(tours.begin(), tours.end(),
+                                   [](const std::vector<int>& tour) { return tour.empty(); }),
+                    tours.end());
 
-                    else
-                    {
-                        notes = "Normal waste generation.";
-                    }
+        // Each tour fits a distinct vehicle, so every tour is served; the matching only
+        // decides which vehicle drives which tour to use the least fuel
+        std::vector<int> tourLoads;
+        std::vector<double> tourDistances;
+        for (const auto& tour : tours)
+        {
+            int tourLoad = 0;
+            for (int stop : tour)
+            {
+                tourLoad += load[stop];
+            }
+            tourLoads.push_back(tourLoad);
+            tourDistances.push_back(tourLength(tour, dist));
+        }
+        std::vector<int> vehicleOf = assignFreeVehicles(tourLoads, tourDistances);
 
-                    file << area.name << "," << area.address << "," << area.city << ","
-                         << population << "," << totalWastePerDay << "," << totalWastePerYear << "," << notes << endl;
+        int allotted = 0;
+        int tourCount = 0;
+        double totalDistance = 0.0;
+        double separateDistance = 0.0;
+        double totalFuel = 0.0;
+        for (size_t t = 0; t < tours.size(); t++)
+        {
+            std::vector<int> wasteIndexes;
+            for (int stop : tours[t])
+            {
+                wasteIndexes.push_back(pending[stop - 1]);
+            }
+
+            int vehicleIndex = vehicleOf[t];
+            if (vehicleIndex == -1)
+            {
+                for (int wasteIndex : wasteIndexes)
+                {
+                    notAllotted.push_back({wasteIndex, "no free vehicle or driver"});
                 }
+                continue;
             }
 
-            file.close();
-            cout << "Waste data successfully saved to \"" << filename << "\".\n";
+            // Expand the tour into the areas driven through, back to Kanabargi
+            std::vector<int> path = {depot};
+            int at = depot;
+            for (size_t k = 0; k <= tours[t].size(); k++)
+            {
+                int next = k < tours[t].size() ? stopArea[tours[t][k]] : depot;
+                int legDistance = 0;
+                std::vector<int> leg = shortestPath(at, next, legDistance);
+                path.insert(path.end(), leg.begin() + 1, leg.end());
+                at = next;
+            }
+
+            takeVehicle(vehicleIndex);
+            int driverIndex = takeDriver();
+            recordAllocation(wasteIndexes, vehicleIndex, driverIndex, path, static_cast<int>(tourDistances[t]), date);
+
+            allotted += wasteIndexes.size();
+            tourCount++;
+            totalDistance += tourDistances[t];
+            totalFuel += tourDistances[t] / vehicles[vehicleIndex].mileage;
+            for (int stop : tours[t])
+            {
+                separateDistance += dist[0][stop] + dist[stop][0];
+            }
         }
-        else
+
+        std::cout << "Allotted " << allotted << " waste piles on " << date << " in " << tourCount << " collection tours ("
+                  << totalDistance << " km against " << separateDistance << " km as separate round trips, "
+                  << totalFuel << " liters)" << std::endl;
+        std::sort(notAllotted.begin(), notAllotted.end());
+        for (const auto& [wasteIndex, reason] : notAllotted)
         {
-            cout << "Invalid choice. Returning to the main menu.\n";
+            std::cout << "  Not allotted: waste in " << wastes[wasteIndex].area << " (" << wastes[wasteIndex].quantity
+                      << " kg), " << reason << std::endl;
         }
-    }
 
-    cout << "\nWaste generation calculations are complete.\n";
-}
-void AreaDatabase::sortAreasByName()
-{
-    if (areas.empty())
-    {
-        cout << "No areas to sort. Please load area data first.\n";
-        return;
+        return allotted;
     }
 
-    // User chooses the sorting order
-    char orderChoice;
-    cout << "Choose sorting order:\n";
-    cout << "1. Ascending (A-Z)\n";
-    cout << "2. Descending (Z-A)\n";
-    cout << "Enter your choice (1/2): ";
-    cin >> orderChoice;
 
-    if (orderChoice != '1' && orderChoice != '2')
+    // Time to load a pile once the vehicle reaches it, in the fleet simulation
+    static constexpr double LOADING_MINUTES = 15.0;
+
+
+    // Discrete-event simulation of one day of collections. Piles arrive and wait in
+    // arrival order; whenever a pile arrives or a vehicle comes back, every waiting pile
+    // that a free vehicle (chosen by policy) and a free driver can take is dispatched.
+    // A trip is the round trip from Kanabargi timed by calculateTravelTime at its
+    // departure (so speed profiles apply) plus LOADING_MINUTES, after which the vehicle
+    // and driver are free again. Works on copies of the pools: the real vehicles,
+    // drivers and allocations are not touched
+    SimulationReport simulateDay(std::vector<WasteArrival> arrivals, AllocationPolicy policy)
     {
-        cout << "Invalid choice. Please enter 1 or 2.\n";
-        return;
+        SimulationReport report;
+        report.vehicleCount = vehicles.size();
+        std::sort(arrivals.begin(), arrivals.end(),
+                  [](const WasteArrival& a, const WasteArrival& b) { return a.minute < b.minute; });
+        if (arrivals.empty())
+            return report;
+
+        int largest = 0;
+        for (const auto& vehicle : vehicles)
+        {
+            largest = std::max(largest, vehicle.loadCapacity);
+        }
+
+        std::multiset<std::pair<int, int>> freeBySize;
+        std::set<int> freeByIndex;
+        for (int v = 0; v < static_cast<int>(vehicles.size()); v++)
+        {
+            freeBySize.insert({vehicles[v].loadCapacity, v});
+            freeByIndex.insert(v);
+        }
+        int freeDriverCount = drivers.size();
+
+        // Round-trip route and its length per area; only its timing depends on the departure
+        std::unordered_map<int, std::pair<std::vector<int>, int>> roundTrips;
+        auto roundTrip = [&](int area) -> const std::pair<std::vector<int>, int>&
+        {
+            auto found = roundTrips.find(area);
+            if (found != roundTrips.end())
+                return found->second;
+
+            int outDistance = 0, backDistance = 0;
+            std::vector<int> path = shortestPath(0, area, outDistance);
+            std::vector<int> back = shortestPath(area, 0, backDistance);
+            if (path.empty() || back.empty())
+                path.clear();
+            else
+                path.insert(path.end(), back.begin() + 1, back.end());
+            return roundTrips.emplace(area, std::make_pair(std::move(path), outDistance + backDistance)).first->second;
+        };
+
+        // Returns are (minute, vehicle); they are handled before arrivals at the same minute
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> returns;
+        std::vector<int> waiting;
+        report.startMinute = arrivals.front().minute;
+        report.endMinute = report.startMinute;
+
+        auto dispatch = [&](double now)
+        {
+            std::size_t kept = 0;
+            for (std::size_t k = 0; k < waiting.size(); k++)
+            {
+                const WasteArrival& pile = arrivals[waiting[k]];
+                int vehicle = -1;
+                if (freeDriverCount > 0 && policy == AllocationPolicy::BestFit)
+                {
+                    auto it = freeBySize.lower_bound({pile.quantity, -1});
+                    vehicle = it == freeBySize.end() ? -1 : it->second;
+                }
+                else if (freeDriverCount > 0)
+                {
+                    for (int v : freeByIndex)
+                    {
+                        if (vehicles[v].loadCapacity >= pile.quantity)
+                        {
+                            vehicle = v;
+                            break;
+                        }
+                    }
+                }
+                if (vehicle == -1)
+                {
+                    waiting[kept++] = waiting[k];
+                    continue;
+                }
+
+                freeBySize.erase(freeBySize.find({vehicles[vehicle].loadCapacity, vehicle}));
+                freeByIndex.erase(vehicle);
+                freeDriverCount--;
+
+                const auto& [path, distance] = roundTrip(pile.areaId);
+                double tripMinutes = calculateTravelTime(path, now) * 60 + LOADING_MINUTES;
+                returns.push({now + tripMinutes, vehicle});
+                report.distanceKm += distance;
+                report.fuelLiters += distance / vehicles[vehicle].mileage;
+
+                double wait = now - pile.minute;
+                report.served++;
+                report.collectedKg += pile.quantity;
+                report.busyVehicleMinutes += tripMinutes;
+                report.totalWaitMinutes += wait;
+                report.maxWaitMinutes = std::max(report.maxWaitMinutes, wait);
+                report.endMinute = std::max(report.endMinute, now + tripMinutes);
+            }
+            waiting.resize(kept);
+        };
+
+        std::size_t next = 0;
+        while (next < arrivals.size() || !returns.empty())
+        {
+            bool vehicleBack = !returns.empty() && (next == arrivals.size() || returns.top().first <= arrivals[next].minute);
+            double now = vehicleBack ? returns.top().first : arrivals[next].minute;
+            if (vehicleBack)
+            {
+                int vehicle = returns.top().second;
+                returns.pop();
+                freeBySize.insert({vehicles[vehicle].loadCapacity, vehicle});
+                freeByIndex.insert(vehicle);
+                freeDriverCount++;
+            }
+            else
+            {
+                const WasteArrival& pile = arrivals[next];
+                report.arrived++;
+                bool known = pile.areaId >= 0 && pile.areaId < static_cast<int>(areas.size());
+                if (!known || pile.quantity > largest || drivers.empty() || roundTrip(pile.areaId).first.empty())
+                    report.rejected++;
+                else
+                    waiting.push_back(static_cast<int>(next));
+                next++;
+            }
+            dispatch(now);
+        }
+
+        // Anything still waiting could never be served (no vehicle will come back)
+        report.rejected += waiting.size();
+        return report;
     }
 
-    // Perform sorting based on the user's choice
-    if (orderChoice == '1')
+
+    // One of each vehicle model in the fleet (the first registered of that model), the
+    // catalogue the scenario runner builds fleet mixes from
+    std::vector<Vehicle> getVehicleModels() const
     {
-        sort(areas.begin(), areas.end(), [](const Area& a, const Area& b) {
-            return a.name < b.name;
-        });
-        cout << "Areas sorted in ascending order by name.\n";
+        std::vector<Vehicle> models;
+        std::set<std::string> seen;
+        for (const auto& vehicle : vehicles)
+        {
+            if (seen.insert(vehicle.vehicleModel).second)
+            {
+                models.push_back(vehicle);
+                models.back().isAllotted = false;
+            }
+        }
+        return models;
     }
 
-    else
+
+    // Drops every vehicle, driver, waste pile and allocation (the road network stays)
+    void resetFleet()
     {
-        sort(areas.begin(), areas.end(), [](const Area& a, const Area& b) {
-            return a.name > b.name;
-        });
-        cout << "Areas sorted in descending order by name.\n";
+        vehicles.clear();
+        drivers.clear();
+        wastes.clear();
+        freeVehicles.clear();
+        freeDrivers.clear();
+        clearAllocations();
     }
 
-    // Display the sorted list
-    cout << "\nSorted Areas:\n";
-    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-    cout << string(110, '-') << endl;
-    for (const auto& area : areas)
+
+    // Drops every allocation with its history, fuel totals, names and routes
+    void clearAllocations()
     {
-        cout << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
+        allocations.clear();
+        vehicleHistory.clear();
+        fuelLedger.clear();
+        allocationStrings.clear();
+        routeArena.clear();
+        allocationLogIds.clear();
     }
 
-    // Additional options after sorting
-    char furtherActionOption;
-    cout << "\nWould you like to perform further actions on the sorted list? (y/n): ";
-    cin >> furtherActionOption;
 
-    if (furtherActionOption == 'y' || furtherActionOption == 'Y')
+    // Takes other's road network and routing setup: areas, roads, coordinates, speed
+    // profiles, dispatch time and, when up to date, the all-pairs table and contraction
+    // hierarchy, so a scenario instance does not rebuild them. other is only read
+    void copyRoadNetworkFrom(const BelgaumWasteManagement& other)
     {
-        char actionChoice;
-        cout << "\nChoose an action:\n";
-        cout << "1. Save the sorted list to a file\n";
-        cout << "2. Filter areas by starting letter\n";
-        cout << "3. Search for an area by name\n";
-        cout << "Enter your choice (1/2/3): ";
-        cin >> actionChoice;
+        areas = other.areas;
+        areaIndex = other.areaIndex;
+        areaLatitude = other.areaLatitude;
+        areaLongitude = other.areaLongitude;
+        edgeOffsets = other.edgeOffsets;
+        edgeTargets = other.edgeTargets;
+        edgeWeights = other.edgeWeights;
+        edgeProfile = other.edgeProfile;
+        speedProfiles = other.speedProfiles;
+        dispatchMinute = other.dispatchMinute;
+        routeAlgorithm = other.routeAlgorithm;
+        resolveWasteAreas();
+        invalidateRoutes();
 
-        if (actionChoice == '1')
+        if (other.allPairsVersion == other.graphVersion)
         {
-            // Save the sorted list to a file
-            string filename;
-            cout << "Enter filename to save the sorted list: ";
-            cin >> filename;
-            ofstream file(filename);
+            allPairsDistance = other.allPairsDistance;
+            allPairsNext = other.allPairsNext;
+            allPairsVersion = graphVersion;
+        }
+        if (other.hierarchyVersion == other.graphVersion)
+        {
+            hierarchyArcs = other.hierarchyArcs;
+            hierarchyRank = other.hierarchyRank;
+            buildHierarchySearchGraph();
+        }
+    }
 
-            if (!file)
-            {
-                cout << "Error: Could not open file for writing. Please check the file path.\n";
-                return;
-            }
 
-            file << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-            file << string(110, '-') << endl;
+    // The pending waste piles as a day's arrivals, one every intervalMinutes from the
+    // dispatch time, in the order they were registered
+    std::vector<WasteArrival> pendingWasteArrivals(double intervalMinutes) const
+    {
+        std::vector<WasteArrival> arrivals;
+        for (const auto& waste : wastes)
+        {
+            if (!waste.isAllotted)
+                arrivals.push_back({dispatchMinute + arrivals.size() * intervalMinutes, waste.areaId, waste.quantity});
+        }
+        return arrivals;
+    }
 
-            for (const auto& area : areas)
-            {
-                file << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
-            }
 
-            file.close();
-            cout << "Sorted list successfully saved to \"" << filename << "\".\n";
 
-        }
+void displayCollectedWasteByDate() {
+    displayCollectedWasteByDate(allocations.begin(), allocations.end());
+}
 
-        else if (actionChoice == '2')
-        {
-            // Filter areas by starting letter
-            char filterLetter;
-            cout << "Enter the starting letter to filter areas: ";
-            cin >> filterLetter;
 
-            cout << "\nFiltered Areas Starting with '" << filterLetter << "':\n";
-            cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-            cout << string(110, '-') << endl;
+// Collections from fromDate to toDate inclusive (dd/mm/yyyy, already validated)
+void displayCollectedWasteByDate(const std::string& fromDate, const std::string& toDate) {
+    int fromDay = dateToDayNumber(fromDate);
+    int toDay = dateToDayNumber(toDate);
+    if (toDay < fromDay) {
+        // A reversed range holds no days at all
+        displayCollectedWasteByDate(allocations.end(), allocations.end());
+        return;
+    }
+    displayCollectedWasteByDate(allocations.lower_bound(fromDay), allocations.upper_bound(toDay));
+}
 
-            bool found = false;
-            for (const auto& area : areas)
-            {
-                if (tolower(area.name[0]) == tolower(filterLetter))
-                {
-                    found = true;
-                    cout << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
-                }
-            }
 
-            if (!found)
-            {
-                cout << "No areas found starting with '" << filterLetter << "'.\n";
-            }
+void displayCollectedWasteByDate(std::map<int, std::vector<AllocationDetail>>::const_iterator first,
+                                 std::map<int, std::vector<AllocationDetail>>::const_iterator last) {
+    // Check if there are any waste collection records
+    if (first == last) {
+        std::cout << "No waste collection details available.\n";
+        return;
+    }
 
-        }
+    std::cout << "=========================================================\n";
+    std::cout << "             Waste Collection Details by Date            \n";
+    std::cout << "=========================================================\n";
 
-        else if (actionChoice == '3')
-        {
-            // Search for an area by name
-            string searchName;
-            cout << "Enter the area name to search for: ";
-            cin.ignore();
-            getline(cin, searchName);
+    // Iterate through each allocation date and its details
+    for (auto it = first; it != last; ++it) {
+        std::cout << "\nDate: " << dayNumberToDate(it->first) << "\n";
+        std::cout << "---------------------------------------------------------\n";
 
-            cout << "\nSearch Results:\n";
-            cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-            cout << string(110, '-') << endl;
+        // Display all details for a specific date
+        for (const auto& detail : it->second) {
+            displayAllocationDetail(detail);
+            std::cout << "\n---------------------------------------------------------\n";
+        }
 
-            bool found = false;
-            for (const auto& area : areas)
-            {
-                if (area.name.find(searchName) != string::npos)
-                {
-                    found = true;
-                    cout << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
-                }
-            }
+        std::cout << "\n=========================================================\n";
+    }
 
-            if (!found)
-            {
-                cout << "No areas found containing \"" << searchName << "\".\n";
-            }
+    // Summary or concluding message (optional)
+    std::cout << "End of waste collection records.\n";
+}
 
-        }
 
-         else
-        {
-            cout << "Invalid choice. Returning to the main menu.\n";
+void displayAllocationDetail(const AllocationDetail& detail) {
+    std::cout << "  Vehicle Model    : " << allocationStrings[detail.vehicleModel] << "\n";
+    std::cout << "  Driver Name      : " << allocationStrings[detail.driverName] << "\n";
+    std::cout << "  Waste Area       : " << allocationStrings[detail.wasteArea] << "\n";
+    std::cout << "  Fuel Required    : " << detail.fuelRequired << " liters\n";
+    std::cout << "  Route            : ";
+
+    // Print the route with arrows between areas
+    for (const std::int32_t* area = routeArena.begin(detail.route); area != routeArena.end(detail.route); ++area) {
+        std::cout << allocationStrings[*area];
+        if (area + 1 != routeArena.end(detail.route)) {
+            std::cout << " -> ";
         }
     }
-
-    cout << "\nSorting operation complete.\n";
 }
-void AreaDatabase::filterAreasByCity()
-{
-    if (areas.empty())
-    {
-        cout << "No area data available. Please load data first.\n";
+
+
+// Every trip of a vehicle model from fromDate to toDate inclusive (empty strings mean
+// no bound), found by binary search in the vehicle's date-ordered history
+void displayVehicleHistory(const std::string& vehicleModel, const std::string& fromDate, const std::string& toDate) {
+    auto found = vehicleHistory.find(vehicleModel);
+    if (found == vehicleHistory.end()) {
+        std::cout << "No trips recorded for " << vehicleModel << ".\n";
         return;
     }
 
-    string city;
-    cout << "Enter the city to filter areas: ";
-    cin.ignore();
-    getline(cin, city);
+    const auto& trips = found->second;
+    int fromDay = fromDate.empty() ? std::numeric_limits<int>::min() : dateToDayNumber(fromDate);
+    int toDay = toDate.empty() ? std::numeric_limits<int>::max() : dateToDayNumber(toDate);
+    auto first = std::lower_bound(trips.begin(), trips.end(), std::make_pair(fromDay, std::numeric_limits<int>::min()));
+    auto last = std::upper_bound(first, trips.end(), std::make_pair(toDay, std::numeric_limits<int>::max()));
 
-    // Convert input city to lowercase for case-insensitive comparison
-    transform(city.begin(), city.end(), city.begin(), ::tolower);
+    std::cout << "Trips of " << vehicleModel << ": " << (last - first) << "\n";
+    for (auto it = first; it != last; ++it) {
+        std::cout << "\nDate: " << dayNumberToDate(it->first) << "\n";
+        displayAllocationDetail(allocations[it->first][it->second]);
+        std::cout << "\n";
+    }
+}
 
-    cout << "\nAreas in \"" << city << "\":\n";
-    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-    cout << string(110, '-') << endl;
 
-    bool found = false;
-    for (const auto& area : areas)
-    {
-        string areaCity = area.city;
-        transform(areaCity.begin(), areaCity.end(), areaCity.begin(), ::tolower);
+// Adds allocations[day][slot] to its vehicle's history, keeping the history in date order
+void indexAllocation(int day, int slot) {
+    auto& trips = vehicleHistory[allocationStrings[allocations[day][slot].vehicleModel]];
+    std::pair<int, int> trip = {day, slot};
+    // Allocations are nearly always made in date order, so this is normally an append
+    trips.insert(std::upper_bound(trips.begin(), trips.end(), trip), trip);
+}
 
-        if (areaCity == city)
-        {
-            found = true;
-            area.display();
+
+// Rebuilds every vehicle's history and the fuel ledger from allocations
+void rebuildVehicleHistory() {
+    vehicleHistory.clear();
+    fuelLedger.clear();
+    for (const auto& [day, details] : allocations) {
+        for (size_t slot = 0; slot < details.size(); slot++) {
+            vehicleHistory[allocationStrings[details[slot].vehicleModel]].push_back({day, static_cast<int>(slot)});
+            fuelLedger.add(day, details[slot], routeArena);
         }
     }
+}
 
-    if (!found)
+
+// Running fuel and CO2 totals by vehicle, driver, area and day
+const FuelLedger& getFuelLedger() const {
+    return fuelLedger;
+}
+
+
+// Names of the allocations' vehicles, drivers and areas, which the fuel ledger's rows are keyed by
+const StringInterner& getAllocationStrings() const {
+    return allocationStrings;
+}
+
+
+// The vehicle that made an allocation's trip: the one it recorded, if the fleet still has a
+// vehicle of that model there, otherwise (a log from older versions, or another fleet) the
+// first vehicle of the model; nullptr if there is none
+const Vehicle* tripVehicle(const AllocationDetail& detail) const
+{
+    const std::string& model = allocationStrings[detail.vehicleModel];
+    if (detail.vehicle >= 0 && static_cast<std::size_t>(detail.vehicle) < vehicles.size() &&
+        vehicles[detail.vehicle].vehicleModel == model)
     {
-        cout << "No areas found in \"" << city << "\".\n";
-        return;
+        return &vehicles[detail.vehicle];
+    }
+    for (const auto& vehicle : vehicles)
+    {
+        if (vehicle.vehicleModel == model)
+            return &vehicle;
     }
+    return nullptr;
+}
 
-    // Additional options after displaying the filtered list
-    char furtherActionOption;
-    cout << "\nWould you like to perform additional actions on the filtered areas? (y/n): ";
-    cin >> furtherActionOption;
 
-    if (furtherActionOption == 'y' || furtherActionOption == 'Y')
+// Re-plans the stored routes for date (every date when empty) on the current road network,
+// keeping each trip's stops: Kanabargi, the waste areas in order and, for a tour, Kanabargi
+// again. Routes that changed are printed; returns how many changed
+int replanRoutes(const std::string& date)
+{
+    int changed = 0;
+    auto first = date.empty() ? allocations.begin() : allocations.lower_bound(dateToDayNumber(date));
+    auto last = date.empty() ? allocations.end() : allocations.upper_bound(dateToDayNumber(date));
+    for (auto it = first; it != last; ++it)
     {
-        char actionChoice;
-        cout << "\nChoose an action:\n";
-        cout << "1. Save the filtered areas to a file\n";
-        cout << "2. Display the total number of areas in the city\n";
-        cout << "3. Search filtered areas by name\n";
-        cout << "Enter your choice (1/2/3): ";
-        cin >> actionChoice;
+        int day = it->first;
+        std::vector<AllocationDetail>& details = it->second;
 
-        if (actionChoice == '1')
+        for (std::size_t slot = 0; slot < details.size(); slot++)
         {
-            // Save the filtered areas to a file
-            string filename;
-            cout << "Enter filename to save the filtered list: ";
-            cin >> filename;
-
-            ofstream file(filename);
-            if (!file)
+            AllocationDetail& detail = details[slot];
+            if (detail.route.length == 0) continue;
+
+            const std::string& vehicleModel = allocationStrings[detail.vehicleModel];
+            const std::string& wasteArea = allocationStrings[detail.wasteArea];
+            std::int32_t routeFront = *routeArena.begin(detail.route);
+            std::int32_t routeBack = *(routeArena.end(detail.route) - 1);
+            std::vector<int> stops = {getAreaIndex(allocationStrings[routeFront])};
+            for (const std::int32_t* stop = routeArena.begin(detail.stops); stop != routeArena.end(detail.stops); ++stop)
             {
-                cout << "Error: Could not open file for writing. Please check the file path.\n";
-                return;
+                stops.push_back(getAreaIndex(allocationStrings[*stop]));
             }
-
-            file << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-            file << string(110, '-') << endl;
-
-            for (const auto& area : areas)
+            if (routeBack != routeFront || detail.route.length == 1)
+                stops.pop_back();
+            stops.push_back(getAreaIndex(allocationStrings[routeBack]));
+
+            std::vector<int> path = {stops.front()};
+            long long distance = 0;
+            bool reachable = true;
+            for (std::size_t k = 0; reachable && k + 1 < stops.size(); k++)
             {
-                string areaCity = area.city;
-                transform(areaCity.begin(), areaCity.end(), areaCity.begin(), ::tolower);
-
-                if (areaCity == city)
+                if (stops[k] == -1 || stops[k + 1] == -1)
                 {
-                    file << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
+                    reachable = false;
+                    break;
                 }
+                int legDistance = 0;
+                std::vector<int> leg = shortestPath(stops[k], stops[k + 1], legDistance);
+                reachable = !leg.empty();
+                path.insert(path.end(), leg.begin() + (leg.empty() ? 0 : 1), leg.end());
+                distance += legDistance;
             }
 
-            file.close();
-            cout << "Filtered list successfully saved to \"" << filename << "\".\n";
+            if (!reachable)
+            {
+                std::cout << dayNumberToDate(day) << ": " << vehicleModel << " can no longer reach " << wasteArea << "; route kept.\n";
+                continue;
+            }
 
-        }
+            std::vector<std::int32_t> route = internRoute(path);
+            if (routeArena.equals(detail.route, route)) continue;
 
-        else if (actionChoice == '2')
-        {
-            // Count the total number of areas in the city
-            int count = 0;
-            for (const auto& area : areas)
+            fuelLedger.remove(day, detail, routeArena);
+            detail.route = routeArena.add(route);
+            const Vehicle* vehicle = tripVehicle(detail);
+            if (vehicle != nullptr)
             {
-                string areaCity = area.city;
-                transform(areaCity.begin(), areaCity.end(), areaCity.begin(), ::tolower);
+                detail.fuelRequired = distance / vehicle->mileage;
+            }
+            fuelLedger.add(day, detail, routeArena);
+            logAllocation(day, static_cast<int>(slot));
+            changed++;
 
-                if (areaCity == city)
-                {
-                    ++count;
-                }
+            std::cout << dayNumberToDate(day) << ": " << vehicleModel << " re-routed, " << distance << " km: ";
+            for (std::size_t k = 0; k < route.size(); k++)
+            {
+                std::cout << allocationStrings[route[k]] << (k + 1 < route.size() ? " -> " : "");
             }
+            std::cout << "\n";
+        }
+    }
+    return changed;
+}
 
-            cout << "Total number of areas in \"" << city << "\": " << count << "\n";
+// Allocation log format: "BWAL", a version number, then one record per change
+//   'S' <length> <bytes>                                  defines the next string id (from 0)
+//   'A' <date> <slot> <vehicle> <driver> <wasteArea> <fuel> <n> <area> x n <s> <stop> x s
+//       <vehicleIndex>
+// Dates, names and route areas are written once as 'S' records and referred to by id
+// after that (vehicleIndex is a position in the fleet, not a string). An 'A' record puts
+// an allocation at position slot of its date: the next free position adds one, an earlier
+// position replaces it (a re-planned route). Version 1 records end after the route, and
+// their stops are recovered from wasteArea; version 2 records end after the stops
+static constexpr std::int32_t ALLOCATION_LOG_VERSION = 3;
 
-        }
 
-         else if (actionChoice == '3')
-        {
-            // Search filtered areas by name
-            string searchName;
-            cout << "Enter the area name to search within \"" << city << "\": ";
-            cin.ignore();
-            getline(cin, searchName);
-
-            cout << "\nSearch Results:\n";
-            cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
-            cout << string(110, '-') << endl;
-
-            bool foundInSearch = false;
-            for (const auto& area : areas)
-            {
-                string areaCity = area.city;
-                transform(areaCity.begin(), areaCity.end(), areaCity.begin(), ::tolower);
+// Id of text in the open log, writing its 'S' record into buffer the first time
+std::int32_t logString(const std::string& text, std::string& buffer)
+{
+    auto [it, added] = allocationLogStrings.emplace(text, static_cast<std::int32_t>(allocationLogStrings.size()));
+    if (added)
+    {
+        buffer += 'S';
+        appendBinary(buffer, static_cast<std::int32_t>(text.size()));
+        buffer += text;
+    }
+    return it->second;
+}
 
-                if (areaCity == city && area.name.find(searchName) != string::npos)
-                {
-                    foundInSearch = true;
-                    area.display();
-                }
-            }
 
-            if (!foundInSearch)
-            {
-                cout << "No areas found with the name \"" << searchName << "\" in \"" << city << "\".\n";
-            }
+// Log id of an interned allocation string, remembered so each is looked up by text once
+std::int32_t logName(std::int32_t id, std::string& buffer)
+{
+    if (allocationLogIds.size() <= static_cast<std::size_t>(id))
+        allocationLogIds.resize(allocationStrings.size(), -1);
+    if (allocationLogIds[id] < 0)
+        allocationLogIds[id] = logString(allocationStrings[id], buffer);
+    return allocationLogIds[id];
+}
 
-        }
 
-        else
-        {
-            cout << "Invalid choice. Returning to the main menu.\n";
-        }
-    }
+// Appends allocations[day][slot] to the open log, if any, and flushes it so a crash
+// loses at most the record being written
+void logAllocation(int day, int slot)
+{
+    if (!allocationLog.is_open())
+        return;
 
-    cout << "\nFiltering operation complete.\n";
-}
-void AreaDatabase::exportToCSV() const {
-    if (areas.empty())
+    const AllocationDetail& detail = allocations[day][slot];
+    std::string strings, record;
+    record += 'A';
+    appendBinary(record, logString(dayNumberToDate(day), strings));
+    appendBinary(record, static_cast<std::int32_t>(slot));
+    appendBinary(record, logName(detail.vehicleModel, strings));
+    appendBinary(record, logName(detail.driverName, strings));
+    appendBinary(record, logName(detail.wasteArea, strings));
+    appendBinary(record, detail.fuelRequired);
+    appendBinary(record, static_cast<std::int32_t>(detail.route.length));
+    for (const std::int32_t* area = routeArena.begin(detail.route); area != routeArena.end(detail.route); ++area)
     {
-        cout << "No area data available to export. Please load data first.\n";
-        return;
+        appendBinary(record, logName(*area, strings));
     }
-
-    string filename;
-    cout << "Enter filename for export (e.g., areas.csv): ";
-    cin >> filename;
-
-    ofstream file(filename);
-    if (!file)
+    appendBinary(record, static_cast<std::int32_t>(detail.stops.length));
+    for (const std::int32_t* stop = routeArena.begin(detail.stops); stop != routeArena.end(detail.stops); ++stop)
     {
-        cout << "Error: Could not open file \"" << filename << "\" for export.\n";
-        return;
+        appendBinary(record, logName(*stop, strings));
     }
+    appendBinary(record, detail.vehicle);
 
-    // Ask the user if they want to export all columns or select specific ones
-    char exportChoice;
-    cout << "Do you want to export all columns? (y/n): ";
-    cin >> exportChoice;
+    allocationLog << strings << record;
+    allocationLog.flush();
+}
 
-    bool exportAll = (exportChoice == 'y' || exportChoice == 'Y');
-    vector<string> columnsToExport;
 
-    if (!exportAll)
+// Stops of an allocation from a version 1 log, which kept only the joined wasteArea: the
+// whole name when an area on the route has it (it may contain ", " itself), otherwise
+// its ", "-separated parts
+std::vector<std::int32_t> legacyStops(const AllocationDetail& detail)
+{
+    std::vector<std::int32_t> stops;
+    if (std::find(routeArena.begin(detail.route), routeArena.end(detail.route), detail.wasteArea) != routeArena.end(detail.route))
     {
-        cout << "Select columns to export:\n";
-        cout << "1. Area Name\n";
-        cout << "2. Address\n";
-        cout << "3. City\n";
-        cout << "Enter column numbers separated by spaces (e.g., 1 2): ";
-
-        cin.ignore();
-        string columnInput;
-        getline(cin, columnInput);
-
-        istringstream iss(columnInput);
-        int columnNum;
-        while (iss >> columnNum) {
-            if (columnNum == 1) columnsToExport.push_back("Area Name");
-            else if (columnNum == 2) columnsToExport.push_back("Address");
-            else if (columnNum == 3) columnsToExport.push_back("City");
-            else {
-                cout << "Invalid column number: " << columnNum << ". Skipping.\n";
-            }
-        }
-
-        if (columnsToExport.empty())
-        {
-            cout << "No valid columns selected. Export cancelled.\n";
-            return;
-        }
+        stops.push_back(detail.wasteArea);
+        return stops;
     }
 
-    else
+    const std::string& wasteArea = allocationStrings[detail.wasteArea];
+    for (std::size_t start = 0; start <= wasteArea.size();)
     {
-        columnsToExport = {"Area Name", "Address", "City"};
+        std::size_t end = std::min(wasteArea.find(", ", start), wasteArea.size());
+        stops.push_back(allocationStrings.intern(std::string_view(wasteArea).substr(start, end - start)));
+        start = end + 2;
     }
+    return stops;
+}
 
-    // Write the CSV header
-    for (size_t i = 0; i < columnsToExport.size(); ++i)
+
+// Replaces allocations with the contents of a log, in one pass over the mapped file.
+// Records are grouped by date id first, so the date map sees one insert per date.
+// strings receives the log's string table; validBytes is where the last complete record
+// ends and version the log's format version. A crash can leave a partial record at the
+// end, which is ignored; damage anywhere else means the log cannot be trusted, so it is
+// reported and nothing is loaded
+bool readAllocationLog(const std::string& filename, std::vector<std::string>& strings, std::size_t& validBytes,
+                       std::int32_t& version)
+{
+    MappedFile file(filename);
+    if (!file.isOpen())
     {
-        file << columnsToExport[i];
-        if (i < columnsToExport.size() - 1) file << ",";
+        std::cerr << "Error: Unable to open allocation log '" << filename << "'.\n";
+        return false;
     }
-    file << "\n";
 
-    // Ask the user if they want to filter data by city before exporting
-    char filterChoice;
-    cout << "Do you want to filter data by city before export? (y/n): ";
-    cin >> filterChoice;
-
-    string filterCity;
-    bool applyFilter = (filterChoice == 'y' || filterChoice == 'Y');
-    if (applyFilter)
+    const char* at = file.data();
+    const char* end = at + file.size();
+    version = 0;
+    bool isLog = file.size() >= 4 && std::memcmp(at, "BWAL", 4) == 0;
+    at += isLog ? 4 : 0;
+    if (!isLog || !readBinary(at, end, version) || version < 1 || version > ALLOCATION_LOG_VERSION)
     {
-        cout << "Enter the city to filter by: ";
-        cin.ignore();
-        getline(cin, filterCity);
-        transform(filterCity.begin(), filterCity.end(), filterCity.begin(), ::tolower);
+        std::cerr << "Error: '" << filename << "' is not an allocation log.\n";
+        return false;
     }
 
-    // Write the data
-    bool found = false;
-    for (const auto& area : areas)
+    // Records as read, still in log string ids: the allocations in memory are only
+    // replaced once the whole file has been checked
+    struct LoggedAllocation
     {
-        if (applyFilter)
+        std::int32_t vehicle, driver, wasteArea;
+        double fuelRequired;
+        std::size_t route;
+        std::int32_t length;
+        std::size_t stops;
+        std::int32_t stopCount;
+        std::int32_t vehicleIndex;
+    };
+    std::vector<std::string> logStrings;
+    std::vector<std::vector<LoggedAllocation>> byDate;
+    std::vector<std::int32_t> routes;
+    const char* recordStart = at;
+    // A record cut short by the end of the file, and one that is wrong while complete
+    bool torn = false, damaged = false;
+    while (at < end && !torn && !damaged)
+    {
+        recordStart = at;
+        char type = *at++;
+        std::int32_t length = 0;
+        if (type == 'S')
         {
-            string areaCity = area.city;
-            transform(areaCity.begin(), areaCity.end(), areaCity.begin(), ::tolower);
-            if (areaCity != filterCity) continue;
+            torn = !readBinary(at, end, length) || (length >= 0 && end - at < length);
+            damaged = !torn && length < 0;
+            if (!torn && !damaged)
+            {
+                logStrings.emplace_back(at, length);
+                at += length;
+            }
+            continue;
         }
-
-        found = true;
-
-        for (size_t i = 0; i < columnsToExport.size(); ++i)
+        if (type != 'A')
         {
-            if (columnsToExport[i] == "Area Name") file << area.name;
-            else if (columnsToExport[i] == "Address") file << area.address;
-            else if (columnsToExport[i] == "City") file << area.city;
-
-            if (i < columnsToExport.size() - 1) file << ",";
+            damaged = true;
+            break;
         }
-        file << "\n";
-    }
-
-    if (!found && applyFilter)
-    {
-        cout << "No data found for the specified city \"" << filterCity << "\".\n";
-    }
 
-    file.close();
-    cout << "Data exported to \"" << filename << "\" successfully.\n";
+        std::int32_t date = 0, slot = 0;
+        LoggedAllocation record;
+        torn = !readBinary(at, end, date) || !readBinary(at, end, slot) ||
+               !readBinary(at, end, record.vehicle) || !readBinary(at, end, record.driver) ||
+               !readBinary(at, end, record.wasteArea) || !readBinary(at, end, record.fuelRequired) ||
+               !readBinary(at, end, length) ||
+               (length >= 0 && static_cast<std::size_t>(end - at) < length * sizeof(std::int32_t));
+        if (torn)
+            break;
 
-    // Ask if the user wants to view the exported data
-    char viewChoice;
-    cout << "Do you want to view the exported file? (y/n): ";
-    cin >> viewChoice;
+        std::int32_t count = logStrings.size();
+        auto known = [count](std::int32_t id) { return id >= 0 && id < count; };
+        damaged = !known(date) || !known(record.vehicle) || !known(record.driver) || !known(record.wasteArea) ||
+                  slot < 0 || length < 0;
+        record.route = routes.size();
+        record.length = length;
+        for (std::int32_t k = 0; k < length && !damaged; k++)
+        {
+            std::int32_t area = 0;
+            readBinary(at, end, area);
+            damaged = !known(area);
+            routes.push_back(area);
+        }
+        if (damaged)
+            break;
 
-    if (viewChoice == 'y' || viewChoice == 'Y')
-    {
-        ifstream viewFile(filename);
-        if (viewFile)
+        // The stops go in the same array as the routes; none in a version 1 record
+        record.stops = routes.size();
+        record.stopCount = 0;
+        if (version >= 2)
         {
-            cout << "\nExported Data:\n";
-            string line;
-            while (getline(viewFile, line)) {
-                cout << line << "\n";
+            torn = !readBinary(at, end, record.stopCount) ||
+                   (record.stopCount >= 0 && static_cast<std::size_t>(end - at) < record.stopCount * sizeof(std::int32_t));
+            if (torn)
+                break;
+            damaged = record.stopCount < 0;
+            for (std::int32_t k = 0; k < record.stopCount && !damaged; k++)
+            {
+                std::int32_t stop = 0;
+                readBinary(at, end, stop);
+                damaged = !known(stop);
+                routes.push_back(stop);
             }
-            viewFile.close();
+            if (damaged)
+                break;
         }
-
-        else
+        record.vehicleIndex = -1;
+        if (version >= 3)
         {
-            cout << "Error: Could not open file \"" << filename << "\" for viewing.\n";
+            torn = !readBinary(at, end, record.vehicleIndex);
+            if (torn)
+                break;
+            damaged = record.vehicleIndex < -1;
+            if (damaged)
+                break;
         }
+
+        if (byDate.size() <= static_cast<std::size_t>(date))
+            byDate.resize(date + 1);
+        std::vector<LoggedAllocation>& records = byDate[date];
+        if (static_cast<std::size_t>(slot) < records.size())
+            records[slot] = record;
+        else if (static_cast<std::size_t>(slot) == records.size())
+            records.push_back(record);
+        else
+            damaged = true;
     }
-}
-void AreaDatabase::calculateAveragePopulation() const
- {
-    if (populationData.empty())
+    validBytes = (torn || damaged ? recordStart : at) - file.data();
+    if (damaged)
     {
-        cout << "No population data available. Please enter population data first.\n";
-        return;
+        std::cerr << "Error: allocation log '" << filename << "' is damaged at byte " << validBytes
+                  << "; nothing was loaded and the file was left unchanged.\n";
+        return false;
+    }
+    if (torn)
+    {
+        std::cerr << "Warning: allocation log '" << filename << "' ends with a partial record; it was ignored.\n";
     }
 
-    // Display options for filtering data before calculation
-    char filterChoice;
-    cout << "Do you want to calculate the average population for all areas or filter by city? (a: All, c: City): ";
-    cin >> filterChoice;
-
-    double totalPopulation = 0;
-    int count = 0;
+    strings = std::move(logStrings);
+    clearAllocations();
+    // Log string id -> allocationStrings id, interned when first used by an allocation
+    std::vector<std::int32_t> interned(strings.size(), -1);
+    auto intern = [&](std::int32_t id) {
+        if (interned[id] < 0)
+            interned[id] = allocationStrings.intern(strings[id]);
+        return interned[id];
+    };
+    std::vector<std::int32_t> route;
 
-    if (filterChoice == 'c' || filterChoice == 'C')
+    // Dates are parsed once per date here, not once per record
+    for (std::size_t date = 0; date < byDate.size(); date++)
     {
-        // Filter by city
-        string filterCity;
-        cout << "Enter the city to calculate the average population for: ";
-        cin.ignore();
-        getline(cin, filterCity);
-        transform(filterCity.begin(), filterCity.end(), filterCity.begin(), ::tolower);
+        if (byDate[date].empty())
+            continue;
 
-        for (const auto& area : areas)
+        std::vector<AllocationDetail>& details = allocations[dateToDayNumber(strings[date])];
+        for (const LoggedAllocation& record : byDate[date])
         {
-            string areaCity = area.city;
-            transform(areaCity.begin(), areaCity.end(), areaCity.begin(), ::tolower);
-
-            if (areaCity == filterCity)
+            AllocationDetail detail;
+            detail.vehicleModel = intern(record.vehicle);
+            detail.driverName = intern(record.driver);
+            detail.wasteArea = intern(record.wasteArea);
+            detail.fuelRequired = record.fuelRequired;
+            detail.vehicle = record.vehicleIndex;
+            route.clear();
+            for (std::int32_t k = 0; k < record.length; k++)
             {
-                string areaName = area.name;
-                areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
-
-                auto it = populationData.find(areaName);
-                if (it != populationData.end())
-                {
-                    totalPopulation += it->second;
-                    ++count;
-                }
+                route.push_back(intern(routes[record.route + k]));
+            }
+            detail.route = routeArena.add(route);
+            route.clear();
+            for (std::int32_t k = 0; k < record.stopCount; k++)
+            {
+                route.push_back(intern(routes[record.stops + k]));
             }
+            if (version == 1)
+                route = legacyStops(detail);
+            detail.stops = routeArena.add(route);
+            details.push_back(detail);
+        }
+    }
+    rebuildVehicleHistory();
+    return true;
+}
+
+
+// Loads an allocation log and appends every later allocation to it. A log that does not
+// exist yet is created holding the allocations already in memory. A damaged log is not
+// opened (and not changed), so allocations are not logged until it is dealt with
+bool openAllocationLog(const std::string& filename)
+{
+    allocationLog.close();
+    allocationLogStrings.clear();
+    allocationLogIds.clear();
+    allocationLogName = filename;
+
+    if (!std::ifstream(filename))
+    {
+        std::ofstream created(filename, std::ios::binary);
+        std::string header = "BWAL";
+        appendBinary(header, ALLOCATION_LOG_VERSION);
+        created << header;
+        if (!created)
+        {
+            std::cerr << "Error: Unable to create allocation log '" << filename << "'.\n";
+            return false;
         }
+        created.close();
 
-        if (count == 0)
+        allocationLog.open(filename, std::ios::binary | std::ios::app);
+        for (const auto& [day, details] : allocations)
         {
-            cout << "No population data found for areas in the city \"" << filterCity << "\".\n";
-            return;
+            for (std::size_t slot = 0; slot < details.size(); slot++)
+            {
+                logAllocation(day, static_cast<int>(slot));
+            }
         }
+        return static_cast<bool>(allocationLog);
+    }
 
-        cout << "Calculating average population for city \"" << filterCity << "\"...\n";
+    std::vector<std::string> strings;
+    std::size_t validBytes = 0;
+    std::int32_t version = 0;
+    if (!readAllocationLog(filename, strings, validBytes, version))
+        return false;
+    if (version < ALLOCATION_LOG_VERSION)
+    {
+        // New records must match the header, so an older log is rewritten in the current format
+        return rewriteAllocationLog(filename) >= 0 && openAllocationLog(filename);
     }
 
-    else
+    // Drop a partial record left by a crash so new records follow a complete one
+    if (validBytes < std::filesystem::file_size(filename))
+        std::filesystem::resize_file(filename, validBytes);
+    for (std::size_t id = 0; id < strings.size(); id++)
     {
-        // Calculate for all areas
-        cout << "Calculating average population for all areas...\n";
-        for (const auto& entry : populationData)
-        {
-            totalPopulation += entry.second;
-            ++count;
-        }
+        allocationLogStrings.emplace(strings[id], static_cast<std::int32_t>(id));
     }
 
-    // Calculate average population
-    double averagePopulation = totalPopulation / count;
-    cout << "Total Population: " << totalPopulation << endl;
-    cout << "Number of Areas Considered: " << count << endl;
-    cout << "The average population is: " << averagePopulation << endl;
+    allocationLog.open(filename, std::ios::binary | std::ios::app);
+    return static_cast<bool>(allocationLog);
+}
 
-    // Additional feature: Save results to a file
-    char saveChoice;
-    cout << "Do you want to save the results to a file? (y/n): ";
-    cin >> saveChoice;
 
-    if (saveChoice == 'y' || saveChoice == 'Y')
+// Rewrites the allocation log with just the current allocations (replaced routes and
+// repeated strings dropped) and keeps appending to it
+bool storeDataInFile()
+{
+    std::string filename = allocationLogName.empty() ? ALLOCATION_LOG_FILE : allocationLogName;
+    if (!allocationLog.is_open() && std::ifstream(filename))
     {
-        string filename;
-        cout << "Enter the filename to save results (e.g., average_population.txt): ";
-        cin >> filename;
+        // openAllocationLog refused it (damaged): keep it for inspection rather than overwrite it
+        std::cerr << "Error: allocation log '" << filename << "' is not open; move it aside before storing.\n";
+        return false;
+    }
 
-        ofstream file(filename);
-        if (!file)
-        {
-            cout << "Error: Could not open file \"" << filename << "\" for writing.\n";
-            return;
-        }
-string filterCity;
-        file << "Population Analysis Results\n";
-        file << "----------------------------\n";
-        file << "Total Population: " << totalPopulation << "\n";
-        file << "Number of Areas Considered: " << count << "\n";
-        file << "Average Population: " << averagePopulation << "\n";
+    long long records = rewriteAllocationLog(filename);
+    if (records < 0 || !openAllocationLog(filename))
+        return false;
 
-        if (filterChoice == 'c' || filterChoice == 'C')
+    std::cout << "Data stored successfully in " << filename << " (" << records << " allocations)" << std::endl;
+    return true;
+}
+
+
+// Writes the current allocations to filename as a new log, through a temporary file so the
+// old log survives a failure, and leaves the log closed. Returns the allocations written,
+// or -1
+long long rewriteAllocationLog(const std::string& filename)
+{
+    std::string compacted = filename + ".tmp";
+    allocationLog.close();
+    allocationLogStrings.clear();
+    allocationLogIds.clear();
+    allocationLog.open(compacted, std::ios::binary | std::ios::trunc);
+    if (!allocationLog)
+    {
+        std::cerr << "Error opening file for writing." << std::endl;
+        return -1;
+    }
+
+    std::string header = "BWAL";
+    appendBinary(header, ALLOCATION_LOG_VERSION);
+    allocationLog << header;
+    long long records = 0;
+    for (const auto& [day, details] : allocations)
+    {
+        for (std::size_t slot = 0; slot < details.size(); slot++)
         {
-            file << "Filtered City: " << filterCity << "\n";
-        } else {
-            file << "Filter: None (All Areas Considered)\n";
+            logAllocation(day, static_cast<int>(slot));
+            records++;
         }
+    }
+    allocationLog.close();
 
-        file.close();
-        cout << "Results saved to \"" << filename << "\" successfully.\n";
+    // Replaces the old log in one step (MoveFileEx with MOVEFILE_REPLACE_EXISTING on Windows),
+    // so a crash leaves either the old log or the new one
+    std::error_code error;
+    std::filesystem::rename(compacted, filename, error);
+    if (error)
+    {
+        std::cerr << "Error: Unable to replace '" << filename << "'.\n";
+        return -1;
     }
+    return records;
+}
 
-    // Additional feature: Display histogram of population distribution
-    char histogramChoice;
-    cout << "Do you want to view a population histogram? (y/n): ";
-    cin >> histogramChoice;
-
-    if (histogramChoice == 'y' || histogramChoice == 'Y') {
-        cout << "\nPopulation Histogram:\n";
-        cout << left << setw(20) << "Area Name" << setw(20) << "Population" << endl;
-        cout << string(40, '-') << endl;
+//display the content of file
 
-        for (const auto& entry : populationData) {
-            cout << left << setw(20) << entry.first << setw(20) << entry.second << endl;
-        }
+void displayFileContent(const std::string& filename)
+{
 
-        cout << "\nHistogram displayed successfully.\n";
-    }
-}
-void AreaDatabase::printPopulationStats() const {
-    if (populationData.empty())
-    {
-        cout << "No population data available.\n";
+    // Attempt to open the file for reading
+    std::ifstream inFile(filename);
+    if (!inFile)
+      {
+        std::cerr << "Error: Unable to open file '" << filename << "' for reading.\n";
         return;
     }
 
-    // Display population statistics
-    cout << "Population Statistics:\n";
-    cout << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
-    cout << string(50, '-') << endl;
+    // Display a header for better clarity
+    std::cout << "=========================================================\n";
+    std::cout << "                 Displaying File Content                 \n";
+    std::cout << "=========================================================\n";
 
-    for (const auto& entry : populationData) {
-        cout << left << setw(30) << entry.first << setw(20) << entry.second << endl;
-    }
+    // Read and display file content line by line
 
-    // Calculate total, minimum, maximum, and average population
-    double totalPopulation = 0;
-    double minPopulation = numeric_limits<double>::max();
-    double maxPopulation = numeric_limits<double>::min();
-    string minArea, maxArea;
+    std::string line;
+    bool isEmpty = true;
+    while (std::getline(inFile, line))
 
-    for (const auto& entry : populationData)
-    {
-        totalPopulation += entry.second;
-        if (entry.second < minPopulation)
-        {
-            minPopulation = entry.second;
-            minArea = entry.first;
-        }
+      {
+        isEmpty = false;
+        std::cout << line << "\n";
+    }
 
-        if (entry.second > maxPopulation)
-        {
-            maxPopulation = entry.second;
-            maxArea = entry.first;
-        }
+    // Check if the file was empty
+    if (isEmpty)
+      {
+        std::cout << "The file is empty.\n";
     }
 
-    double averagePopulation = totalPopulation / populationData.size();
+    // Footer for better output structure
+    std::cout << "=========================================================\n";
+    std::cout << "                  End of File Content                    \n";
+    std::cout << "=========================================================\n";
 
-    cout << "\nSummary Statistics:\n";
-    cout << "-------------------\n";
-    cout << "Total Population: " << totalPopulation << endl;
-    cout << "Average Population: " << averagePopulation << endl;
-    cout << "Minimum Population: " << minPopulation << " (Area: " << minArea << ")\n";
-    cout << "Maximum Population: " << maxPopulation << " (Area: " << maxArea << ")\n";
+    // Close the file
+    inFile.close();
 
-    // Option to filter data by a population range
-    char filterChoice;
-    cout << "\nDo you want to filter areas by population range? (y/n): ";
-    cin >> filterChoice;
+}
 
-    if (filterChoice == 'y' || filterChoice == 'Y')
-    {
-        double lowerBound, upperBound;
-        cout << "Enter the lower bound for population: ";
-        cin >> lowerBound;
-        cout << "Enter the upper bound for population: ";
-        cin >> upperBound;
+// Load the allocations saved in an allocation log, replacing the ones in memory. An open
+// log that is a different file is rewritten to match, so later records continue it
 
-        cout << "\nAreas with population in the range [" << lowerBound << ", " << upperBound << "]:\n";
-        cout << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
-        cout << string(50, '-') << endl;
+bool loadDataFromFile(const std::string& filename)
+ {
+    std::vector<std::string> strings;
+    std::size_t validBytes = 0;
+    std::int32_t version = 0;
+    if (!readAllocationLog(filename, strings, validBytes, version))
+      {
+        return false;
+    }
 
-        for (const auto& entry : populationData)
-        {
-            if (entry.second >= lowerBound && entry.second <= upperBound)
-            {
-                cout << left << setw(30) << entry.first << setw(20) << entry.second << endl;
-            }
+    std::error_code error;
+    if (allocationLog.is_open() && !std::filesystem::equivalent(filename, allocationLogName, error))
+      {
+        std::string logName = allocationLogName;
+        if (rewriteAllocationLog(logName) < 0 || !openAllocationLog(logName))
+          {
+            return false;
         }
     }
 
-    // Option to save statistics to a file
-    char saveChoice;
-    cout << "\nDo you want to save the statistics to a file? (y/n): ";
-    cin >> saveChoice;
-
-    if (saveChoice == 'y' || saveChoice == 'Y')
-    {
-        string filename;
-        cout << "Enter the filename for saving statistics (e.g., population_stats.txt): ";
-        cin >> filename;
+    std::size_t records = 0;
+    for (const auto& [date, details] : allocations)
+      {
+        records += details.size();
+    }
+    std::cout << "Loaded " << records << " allocations over " << allocations.size() << " dates from " << filename << std::endl;
+    return true;
+}
 
-        ofstream file(filename);
-        if (!file)
-        {
-            cout << "Error: Could not open file \"" << filename << "\" for writing.\n";
-            return;
-        }
+// diplay Menu
+    void displayMenu()
+     {
 
-        file << "Population Statistics:\n";
-        file << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
-        file << string(50, '-') << endl;
+        std::cout << " --------------------------------------------------------------------------------------------------------" << std::endl;
+        std::cout << "    " << std::endl;
+        std::cout << "Belgaum City Waste Management System" << std::endl;
+        std::cout << "1. Allot Vehicle" << std::endl;
+        std::cout << "2. Display Vehicles" << std::endl;
+        std::cout << "3. Display Drivers" << std::endl;
+        std::cout << "4. Display Wastes" << std::endl;
+        std::cout << "5. Shortest Route Details" << std::endl;
+        std::cout << "6. Longest Route Details" << std::endl;
+        std::cout << "7. View Available Vehicles and Drivers" << std::endl;
+        std::cout << "8. Display Collected Waste by Date" << std::endl;
+        std::cout << "9. Save Collected Waste Data to File" << std::endl;
+        std::cout << "10. Load Data from File" << std::endl;
+        std::cout << "11. Exit" << std::endl;
+        std::cout << " ---------------------------------------------------------------------------------------------------------" << std::endl;
 
-        for (const auto& entry : populationData)
-        {
-            file << left << setw(30) << entry.first << setw(20) << entry.second << endl;
-        }
 
-        file << "\nSummary Statistics:\n";
-        file << "-------------------\n";
-        file << "Total Population: " << totalPopulation << endl;
-        file << "Average Population: " << averagePopulation << endl;
-        file << "Minimum Population: " << minPopulation << " (Area: " << minArea << ")\n";
-        file << "Maximum Population: " << maxPopulation << " (Area: " << maxArea << ")\n";
+    }
 
-        double lowerBound, upperBound;
-        if (filterChoice == 'y' || filterChoice == 'Y')
-        {
-            file << "\nFiltered Areas (Range: [" << lowerBound << ", " << upperBound << "]):\n";
-            file << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
-            file << string(50, '-') << endl;
 
-            for (const auto& entry : populationData)
-            {
-                if (entry.second >= lowerBound && entry.second <= upperBound)
-                {
-                    file << left << setw(30) << entry.first << setw(20) << entry.second << endl;
-                }
-            }
-        }
+void viewAvailableVehiclesAndDrivers()
+{
 
-        file.close();
-        cout << "Statistics saved to \"" << filename << "\" successfully.\n";
-    }
+    // Display header for available vehicles
+    std::cout << "=========================================================\n";
+    std::cout << "                   Available Vehicles                   \n";
+    std::cout << "=========================================================\n";
 
-    // Option to visualize population distribution
-    char visualizeChoice;
-    cout << "\nDo you want to visualize the population distribution? (y/n): ";
-    cin >> visualizeChoice;
+    bool foundAvailableVehicle = false;
+    for (size_t i = 0; i < vehicles.size(); i++)
+      {
 
-    if (visualizeChoice == 'y' || visualizeChoice == 'Y')
-    {
-        cout << "\nPopulation Distribution:\n";
-        for (const auto& entry : populationData)
+        if (!vehicles[i].isAllotted)
         {
-            cout << left << setw(30) << entry.first << " | ";
-            int barLength = static_cast<int>(entry.second / maxPopulation * 50);
-            cout << string(barLength, '*') << endl;
+            std::cout << "Vehicle Model: " << vehicles[i].vehicleModel << "\n"
+                      << "  Load Capacity: " << vehicles[i].loadCapacity << " kg\n"
+                      << "  Mileage: " << vehicles[i].mileage << " km/l\n";
+            std::cout << "---------------------------------------------------------\n";
+            foundAvailableVehicle = true;
         }
     }
-}
 
-void AreaDatabase::calculateAverageWasteGeneration() const {
-    double wastePerCapita = 0.74; // Average waste generation rate in kg per person per day
-
-    if (populationData.empty())
-    {
-        cout << "No population data available. Please enter population data first.\n";
-        return;
+    if (!foundAvailableVehicle)
+      {
+        std::cout << "No available vehicles at the moment.\n";
     }
 
-    double totalWaste = 0;
-    int areaCount = 0;
-
-    cout << "\n--- Waste Generation Report ---\n";
-    cout << left << setw(30) << "Area Name" << setw(20) << "Population" << setw(20) << "Waste (kg/day)" << endl;
-    cout << string(70, '-') << endl;
-
-    for (const auto& area : areas)
-    {
-        string areaName = area.name;
-        areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
-
-        auto it = populationData.find(areaName);
-
-        if (it != populationData.end())
-        {
-            double population = it->second;
-            double areaWaste = population * wastePerCapita;
+    // Display header for available drivers
+    std::cout << "\n=========================================================\n";
+    std::cout << "                   Available Drivers                    \n";
+    std::cout << "=========================================================\n";
 
-            totalWaste += areaWaste;
-            ++areaCount;
 
-            cout << left << setw(30) << area.name << setw(20) << population << setw(20) << areaWaste << endl;
-        }
+    bool foundAvailableDriver = false;
+    for (size_t i = 0; i < drivers.size(); i++)
+      {
+        if (!drivers[i].isAllotted)
+          {
 
-        else
-        {
-            cout << left << setw(30) << area.name << setw(20) << "No data" << setw(20) << "N/A" << endl;
+            std::cout << "Driver Name: " << drivers[i].name << "\n"
+                      << "  Age: " << drivers[i].age << "\n"
+                      << "  Address: " << drivers[i].address << "\n";
+            std::cout << "---------------------------------------------------------\n";
+            foundAvailableDriver = true;
         }
     }
 
-    cout << string(70, '-') << endl;
+    if (!foundAvailableDriver)
+      {
 
-    if (areaCount > 0)
-    {
-        double averageWaste = totalWaste / areaCount;
-        cout << "\nThe average waste generation per area is: " << averageWaste << " kg/day.\n";
+        std::cout << "No available drivers at the moment.\n";
     }
 
-    else
-    {
-        cout << "\nNo valid waste generation data available for the areas.\n";
-    }
-char DBL_MAX;
-    // Additional insights
-    double maxWaste = 0, minWaste = DBL_MAX;
-    string maxArea, minArea;
+    // Footer for better structure
+    std::cout << "=========================================================\n";
+    std::cout << "                  End of Availability                   \n";
+    std::cout << "=========================================================\n";
 
-    for (const auto& area : areas)
-    {
-        string areaName = area.name;
-        areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
+}
 
-        auto it = populationData.find(areaName);
+void displayVehicles()
+{
 
-        if (it != populationData.end())
-        {
-            double population = it->second;
-            double areaWaste = population * wastePerCapita;
-
-            if (areaWaste > maxWaste)
-            {
-                maxWaste = areaWaste;
-                maxArea = area.name;
-            }
+    // Display header for the vehicles section
+    std::cout << "=========================================================\n";
+    std::cout << "                    List of Vehicles                    \n";
+    std::cout << "=========================================================\n";
 
-            if (areaWaste < minWaste)
-            {
-                minWaste = areaWaste;
-                minArea = area.name;
-            }
-        }
-    }
+    if (vehicles.empty())
+      {
 
-    if (areaCount > 0)
-    {
-        cout << "Highest waste generation: " << maxArea << " with " << maxWaste << " kg/day.\n";
-        cout << "Lowest waste generation: " << minArea << " with " << minWaste << " kg/day.\n";
+        std::cout << "No vehicles available in the system.\n";
     }
+    else
+      {
 
-    // Optional: Save report
-    string filename;
-    cout << "\nWould you like to save the report to a file? (yes/no): ";
-    string response;
-    cin.ignore();
-    getline(cin, response);
-
-    if (response == "yes")
-    {
-        cout << "Enter the filename for the report: ";
-        getline(cin, filename);
+        for (int i = 0; i < vehicles.size(); i++)
 
-        ofstream reportFile(filename);
-        if (!reportFile)
         {
-            cout << "Error: Unable to create the file \"" << filename << "\".\n";
-            return;
+            std::cout << "---------------------------------------------------------\n";
+            std::cout << "Vehicle " << i + 1 << ":\n";
+            std::cout << "  Model: " << vehicles[i].vehicleModel << "\n"
+                      << "  Load Capacity: " << vehicles[i].loadCapacity << " kg\n"
+                      << "  Mileage: " << vehicles[i].mileage << " km/l\n"
+                      << "  Allotted: " << (vehicles[i].isAllotted ? "Yes" : "No") << "\n";
+            std::cout << "---------------------------------------------------------\n";
         }
 
-        reportFile << "--- Waste Generation Report ---\n";
-        reportFile << left << setw(30) << "Area Name" << setw(20) << "Population" << setw(20) << "Waste (kg/day)" << endl;
-        reportFile << string(70, '-') << endl;
-
-        for (const auto& area : areas) {
-            string areaName = area.name;
-            areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
-
-            auto it = populationData.find(areaName);
-
-            if (it != populationData.end())
-            {
-                double population = it->second;
-                double areaWaste = population * wastePerCapita;
+    }
 
-                reportFile << left << setw(30) << area.name << setw(20) << population << setw(20) << areaWaste << endl;
-            }
+    // Display footer for the vehicles section
+    std::cout << "=========================================================\n";
+    std::cout << "                  End of Vehicle List                   \n";
+    std::cout << "=========================================================\n";
+}
 
-             else
-            {
-                reportFile << left << setw(30) << area.name << setw(20) << "No data" << setw(20) << "N/A" << endl;
-            }
-        }
 
-        reportFile << string(70, '-') << endl;
+void displayDrivers()
+{
+    // Display header for the drivers section
+    std::cout << "=========================================================\n";
+    std::cout << "                    List of Drivers                     \n";
+    std::cout << "=========================================================\n";
 
-        if (areaCount > 0)
-        {
-            reportFile << "\nThe average waste generation per area is: " << totalWaste / areaCount << " kg/day.\n";
-            reportFile << "Highest waste generation: " << maxArea << " with " << maxWaste << " kg/day.\n";
-            reportFile << "Lowest waste generation: " << minArea << " with " << minWaste << " kg/day.\n";
-        }
+    if (drivers.empty())
+      {
 
-        else
-        {
-            reportFile << "\nNo valid waste generation data available for the areas.\n";
+        std::cout << "No drivers available in the system.\n";
+    }
+    else
+      {
+        for (int i = 0; i < drivers.size(); i++)
+         {
+            std::cout << "---------------------------------------------------------\n";
+            std::cout << "Driver " << i + 1 << ":\n";
+            std::cout << "  Name: " << drivers[i].name << "\n"
+                      << "  Age: " << drivers[i].age << " years\n"
+                      << "  Address: " << drivers[i].address << "\n";
+            std::cout << "---------------------------------------------------------\n";
         }
 
-        reportFile.close();
-        cout << "Report successfully saved to \"" << filename << "\".\n";
     }
 
-    else
-    {
-        cout << "Report not saved.\n";
-    }
-}
+    // Display footer for the drivers section
+    std::cout << "=========================================================\n";
+    std::cout << "                  End of Driver List                    \n";
+    std::cout << "=========================================================\n";
 
+}
 
-int wastegeneration()
+void displayWastes()
 {
-    AreaDatabase database;
-    database.displayWelcomeMessage();
 
-    int choice;
+    // Display header for the wastes section
+    std::cout << "=========================================================\n";
+    std::cout << "                    Waste Information                    \n";
+    std::cout << "=========================================================\n";
 
-    do {
-        cout << "\nMenu:\n";
-        cout << "1. Load Area Data from File\n";
-        cout << "2. Display All Areas\n";
-        cout << "3. Update Area Data\n";
-        cout << "4. Delete Area by Name\n";
-        cout << "5. Add New Area\n";
-        cout << "6. Save Area Data to File\n";
-        cout << "7. Enter Population Data\n";
-        cout << "8. Calculate Waste Generation\n";
-        cout << "9. Sort Areas by Name\n";
-        cout << "10. Filter Areas by City\n";
-        cout << "11. Export Data to CSV\n";
-        cout << "12. Calculate Average Population\n";
-        cout << "13. Print Population Stats\n";
-        cout << "14. Calculate Average Waste Generation\n"; // New option added
-        cout << "15. Exit\n";
-        cout << "Enter your choice: ";
-        cin >> choice;
+    if (wastes.empty())
+      {
 
-        switch (choice) {
-            case 1:
-                database.loadFromFile();
-                break;
-            case 2:
-                database.displayAllAreas();
-                break;
-            case 3:
-                database.updateAreaData();
-                break;
-            case 4:
-                database.deleteAreaByName();
-                break;
-            case 5:
-                database.addNewArea();
-                break;
-            case 6:
-                database.saveToFile();
-                break;
-            case 7:
-                database.enterPopulationData();
-                break;
-            case 8:
-                database.calculateWasteGeneration();
-                break;
-            case 9:
-                database.sortAreasByName();
-                break;
-            case 10:
-                database.filterAreasByCity();
-                break;
-            case 11:
-                database.exportToCSV();
-                break;
-            case 12:
-                database.calculateAveragePopulation();
-                break;
-            case 13:
-                database.printPopulationStats();
-                break;
-            case 14:
-                database.calculateAverageWasteGeneration(); // New case added
-                break;
-            case 15:
-                cout << "Exiting program...\n";
-                break;
-            default:
-                cout << "Invalid choice. Please try again.\n";
+        std::cout << "No waste data available.\n";
+    }
+    else
+      {
+        for (int i = 0; i < wastes.size(); i++)
+          {
+            std::cout << "---------------------------------------------------------\n";
+            std::cout << "Waste " << i + 1 << ":\n";
+            std::cout << "  Area: " << wastes[i].area << "\n"
+                      << "  Quantity: " << wastes[i].quantity << " kg\n";
+            std::cout << "---------------------------------------------------------\n";
         }
-    } while (choice != 15);
 
-    return 0;
+    }
+
+    // Display footer for the wastes section
+    std::cout << "=========================================================\n";
+    std::cout << "                   End of Waste List                    \n";
+    std::cout << "=========================================================\n";
 }
 
 
+void findLongestRouteToDestination(int source, int destination)
+{
 
-//module3
-#include <iostream>
-#include <fstream>
-#include <sstream>
-#include <vector>
-#include <string>
-#include <map>
-#include <algorithm>
-#include <limits>
-#include<iomanip>
-#include <regex>
-#include <algorithm>
-#include <cctype>
-#include <conio.h>
-#include <windows.h>
+    // Longest route that does not visit any area twice
+    long long routeDistance = 0;
+    std::vector<int> path = longestRoute(source, destination, routeDistance);
 
-// Define color codes using ANSI escape sequences
-#define RESET "\033[0m"
-#define RED "\033[31m"
-#define GREEN "\033[32m"
-#define YELLOW "\033[33m"
-#define BLUE "\033[34m"
-#define MAGENTA "\033[35m"
-#define CYAN "\033[36m"
-#define WHITE "\033[37m"
-#define BOLD "\033[1m"
+    // Check if the destination is reachable from the source
+    if (path.empty())
+      {
 
+        std::cout << "No path exists from " << areas[source] << " to " << areas[destination] << "." << std::endl;
+        return;
+    }
 
-using namespace std;
+    // Display the longest distance to the destination
+    std::cout << "Longest distance to " << areas[destination] << ": " << routeDistance << " km" << std::endl;
 
-// Structure to store waste data
-struct Wastes
-{
-    // Type of waste (e.g., plastic, paper, etc.)
-    std::string type;
+    // Display the longest route from source to destination
+    std::cout << "Route: ";
+    for (size_t k = 0; k < path.size(); k++)
+    {
 
-    int quantity;
+        std::cout << areas[path[k]] << (k + 1 < path.size() ? " -> " : "");
+    }
 
-     // Location where the waste is stored
-    std::string location;
+    std::cout << std::endl;
 
-     // Date when the waste was recorded
-    std::string date;
+}
 
-     // Condition of the waste (e.g., clean, contaminated)
-    std::string condition;
-};
+ // Existing code...
 
-// Structure to store factory records
-struct FactoryRecord
+    // to simulate vehicle maintenance
+    void performVehicleMaintenance()
+    {
+        // Placeholder for maintenance logic
+    }
+
+    //  to simulate driver training
+    void conductDriverTraining()
+    {
+        // Placeholder for training logic
+    }
+
+    //  to simulate waste segregation
+    void segregateWaste()
+    {
+        // Placeholder for waste segregation logic
+    }
+
+    //  simulate fuel efficiency calculation
+    void calculateFuelEfficiency()
+    {
+        // Placeholder for fuel efficiency calculation logic
+    }
+
+    // to simulate route optimization
+    void optimizeRoutes()
+    {
+        // Placeholder for route optimization logic
+    }
+
+    // to simulate waste disposal reporting
+    void generateWasteDisposalReport()
+    {
+        // Placeholder for report generation logic
+    }
+
+    //  to simulate emergency response
+    void handleEmergencySituation()
+    {
+        // Placeholder for emergency handling logic
+    }
+
+    //  to simulate vehicle tracking
+    void trackVehicles()
+    {
+        // Placeholder for vehicle tracking logic
+    }
+
+    // to simulate driver feedback collection
+    void collectDriverFeedback()
+    {
+        // Placeholder for feedback collection logic
+    }
+
+    // to simulate waste collection scheduling
+    void scheduleWasteCollection()
+    {
+        // Placeholder for scheduling logic
+    }
+
+    // all remaining functions
+
+//calculate shortest route
+// use of dijkastra algorithm
+void findShortestRouteToDestination(int source, int destination)
 {
-     // Type of waste sent to the factory
+    // Look up the shortest route in the precomputed all-pairs table
+    int routeDistance = 0;
+    std::vector<int> path = shortestPath(source, destination, routeDistance);
 
-    std::string wasteType;
-     // Total quantity sent
+    printShortestRoute(source, destination, path, routeDistance);
+}
 
-    int totalQuantity;
-     // Factory name
 
-    std::string factoryName;
-     // Factory location
+// Same report, but searching with the given algorithm instead of using the table
+void findShortestRouteToDestination(int source, int destination, RouteAlgorithm algorithm)
+{
+    int routeDistance = 0;
+    long long settled = 0;
+    std::vector<int> path = routeQuery(source, destination, algorithm, routeDistance, settled);
 
-    std::string factoryLocation;
-};
+    std::cout << "Areas settled by the search: " << settled << std::endl;
+    printShortestRoute(source, destination, path, routeDistance);
+}
 
-// Global containers to store records
-std::vector<Wastes> wasteRecords;
-std::vector<FactoryRecord> factoryRecords;
 
-// Function prototypes
-void loadCSV(const std::string& filePath);
-void displayWasteRecords();
-void displayMenu();
-void searchWasteByType();
-void sortWasteRecords();
-void calculateStatistics();
-void saveToCSV(const std::string& filePath);
-void updateWasteRecord();
-void deleteWasteRecord();
-void addNewWasteRecord();
-void sendWasteToFactory();
-void viewFactoryRecords();
-void validateInput(int& input, const std::string& prompt);
-void validateInput(std::string& input, const std::string& prompt);
-void displayFactoryRecords();
-void displayFactoryRecordsByType(const std::string& wasteType);
-void sortFactoryRecordsByQuantity();
-void sortFactoryRecordsByName();
-void sortFactoryRecordsByLocation();
-void displayFactoryRecordsInTable();
-void filterFactoryRecordsByCondition();
-void exportFactoryRecordsToCSV();
-void saveToCSV(const std::string& filePath);
+void printShortestRoute(int source, int destination, const std::vector<int>& path, int routeDistance)
+{
+    // Check if the destination is reachable from the source
+    if (path.empty())
+      {
 
+        std::cout << "No path exists from " << areas[source] << " to " << areas[destination] << "." << std::endl;
+        return;
+    }
 
+    // Display the shortest distance to the destination
+    std::cout << "Shortest distance to " << areas[destination] << ": " << routeDistance << " km" << std::endl;
 
+    // Display the shortest route from source to destination
+    std::cout << "Route: ";
 
-// Function to load data from a CSV file
-void loadCSV(const std::string& filePath)
- {
-    std::ifstream file(filePath);
-    if (!file.is_open())
+    // Output the path from source to destination in human-readable format
+    for (size_t k = 0; k < path.size(); k++)
     {
-        std::cerr << "Error: Could not open file at " << filePath << std::endl;
-        return;
+
+        std::cout << areas[path[k]] << (k + 1 < path.size() ? " -> " : "");
     }
 
-    std::string line;
-    bool isHeader = true;
+    std::cout << std::endl;
 
-    // Reading the file line by line
-    while (std::getline(file, line))
-     {
-        if (isHeader)
+    // Calculate and display additional travel information
+    //in hr and min
+    double totalDistance = routeDistance;
+    double travelTime = calculateTravelTime(path, dispatchMinute);
+
+    // Extract hours and minutes from the travel time
+    int hours = static_cast<int>(travelTime);
+    int minutes = static_cast<int>((travelTime - hours) * 60);
+
+    // Display the travel time and other relevant information
+    std::cout << " =========================================================" << std::endl;
+    std::cout << "Total Distance: " << totalDistance << " km\n";
+
+    // Display the estimated travel time in hours and minutes
+    std::cout << "Estimated Travel Time: " << hours << " hours and " << minutes << " minutes." << std::endl;
+
+    // Additional informative output for the user
+    std::cout << "\nPlease ensure the vehicle is ready for travel and has sufficient fuel." << std::endl;
+    std::cout << "Remember to check the weather and road conditions before starting the journey." << std::endl;
+
+    // Conclusion message
+    std::cout << " =========================================================" << std::endl;
+
+}
+
+};
+
+
+// Benchmark: cost of resolving an area name with the hash index versus the old
+// linear scan over the area list, for networks of 100 up to maxAreas areas
+void benchmarkAreaLookup(int maxAreas)
+{
+    std::mt19937 rng(42);
+    const int lookups = 2000;
+
+    std::cout << std::left << std::setw(12) << "Areas" << std::setw(22) << "Hash lookup (ns)"
+              << std::setw(22) << "Linear scan (ns)" << "Interned id (ns)" << std::endl;
+    std::cout << std::string(72, '-') << std::endl;
+
+    for (int n = 100; n <= maxAreas; n *= 10)
+    {
+        std::vector<std::string> names;
+        names.reserve(n);
+        for (int i = 0; i < n; i++)
         {
-            isHeader = false;  // Skip the header line
-            continue;
+            names.push_back("Ward " + std::to_string(i));
         }
 
-        // Split the line by commas and store data
-        std::stringstream ss(line);
-        std::string type, quantityStr, location, date, condition;
+        BelgaumWasteManagement network;
+        network.setRoadNetwork(names, {});
 
-        if (std::getline(ss, type, ',') &&
-            std::getline(ss, quantityStr, ',') &&
-            std::getline(ss, location, ',') &&
-            std::getline(ss, date, ',') &&
-            std::getline(ss, condition, ','))
+        std::uniform_int_distribution<int> pick(0, n - 1);
+        std::vector<std::string> queries;
+        std::vector<Waste> wasteIds;
+        for (int i = 0; i < lookups; i++)
         {
-            Wastes waste = {type, std::stoi(quantityStr), location, date, condition};
-             // Add the waste record
-            wasteRecords.push_back(waste);
+            queries.push_back(names[pick(rng)]);
+            wasteIds.push_back(Waste(queries.back(), 0));
+            wasteIds.back().areaId = network.getAreaIndex(queries.back());
         }
-        else
+
+        long long checksum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& name : queries)
         {
-            std::cerr << "Malformed line in CSV file.\n";
+            checksum += network.getAreaIndex(name);
+        }
+        double hashNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+
+        const std::vector<std::string>& areaList = network.getAreas();
+        start = std::chrono::steady_clock::now();
+        for (const auto& name : queries)
+        {
+            checksum += std::find(areaList.begin(), areaList.end(), name) - areaList.begin();
         }
+        double linearNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+
+        start = std::chrono::steady_clock::now();
+        for (const auto& waste : wasteIds)
+        {
+            checksum += waste.areaId;
+        }
+        double internedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+
+        // Keep the lookups from being optimised away
+        volatile long long sink = checksum;
+        (void)sink;
+
+        std::cout << std::left << std::setw(12) << n << std::setw(22) << hashNs
+                  << std::setw(22) << linearNs << internedNs << std::endl;
     }
+}
 
-    file.close();
-    std::cout << "Data loaded successfully from the CSV file!\n";
+
+// Benchmark: exact longest route on random two-way networks of 8 up to maxAreas areas,
+// bitmask DP (up to its limit) against branch and bound; both must give the same length
+void benchmarkLongestPath(int maxAreas)
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> weight(1, 50);
+
+    std::cout << std::left << std::setw(8) << "Areas" << std::setw(8) << "Roads" << std::setw(20) << "Bitmask DP (ms)"
+              << std::setw(22) << "Branch & bound (ms)" << std::setw(14) << "Longest (km)" << "Match" << std::endl;
+    std::cout << std::string(78, '-') << std::endl;
+
+    for (int n = 8; n <= maxAreas; n += 2)
+    {
+        std::vector<std::string> names;
+        for (int i = 0; i < n; i++)
+        {
+            names.push_back("Ward " + std::to_string(i));
+        }
+
+        // A random spanning tree keeps it connected, then about one extra road per area
+        std::vector<RoadEdge> roads;
+        for (int v = 1; v < n; v++)
+        {
+            int u = std::uniform_int_distribution<int>(0, v - 1)(rng);
+            int w = weight(rng);
+            roads.push_back({u, v, w});
+            roads.push_back({v, u, w});
+        }
+        for (int k = 0; k < n; k++)
+        {
+            int u = std::uniform_int_distribution<int>(0, n - 1)(rng);
+            int v = std::uniform_int_distribution<int>(0, n - 1)(rng);
+            if (u == v) continue;
+            int w = weight(rng);
+            roads.push_back({u, v, w});
+            roads.push_back({v, u, w});
+        }
+
+        BelgaumWasteManagement network;
+        network.setRoadNetwork(names, roads);
+
+        long long searchLength = -1;
+        bool exhausted = false;
+        auto start = std::chrono::steady_clock::now();
+        network.longestPathSearch(0, n - 1, searchLength, exhausted);
+        double searchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << std::left << std::setw(8) << n << std::setw(8) << roads.size() / 2;
+        if (n <= BelgaumWasteManagement::LONGEST_DP_LIMIT)
+        {
+            long long dpLength = -1;
+            start = std::chrono::steady_clock::now();
+            network.longestPathBitmask(0, n - 1, dpLength);
+            double dpMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << std::setw(20) << dpMs << std::setw(22) << searchMs << std::setw(14) << searchLength
+                      << (dpLength == searchLength ? "yes" : "NO") << std::endl;
+        }
+        else if (exhausted)
+        {
+            std::cout << std::setw(20) << "-" << std::setw(22) << searchMs << std::setw(14) << "gave up" << "-" << std::endl;
+        }
+        else
+        {
+            std::cout << std::setw(20) << "-" << std::setw(22) << searchMs << std::setw(14) << searchLength << "-" << std::endl;
+        }
+    }
 }
 
-// Function to display waste records
-// Function to display waste records with options to filter, sort, and format outputt
-// Function to display waste records in various formats
-void displayWasteRecords()
+
+// Benchmark: random point-to-point queries on the current road network with each
+// algorithm, reporting areas settled and time per query; every algorithm must match
+// the full Dijkstra search on distance
+void benchmarkRouteQueries(BelgaumWasteManagement& network, int queries)
 {
-    if (wasteRecords.empty())
+    int n = network.getAreaCount();
+    if (n == 0 || queries <= 0)
     {
-        std::cout << "No records to display!\n";
         return;
     }
 
-    int choice;
-    bool continueDisplaying = true;
-
-    while (continueDisplaying)
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    std::vector<std::pair<int, int>> pairs;
+    for (int q = 0; q < queries; q++)
     {
-        std::cout << "\nChoose an option to display waste records:\n";
-        std::cout << "1. View All Waste Records\n";
-        std::cout << "2. View Waste Records by Condition\n";
-        std::cout << "3. View Waste Records by Location\n";
-        std::cout << "4. View Waste Records in Table Format\n";
-        std::cout << "5. Back to Main Menu\n";
-        std::cout << "Enter your choice: ";
-        std::cin >> choice;
+        pairs.push_back({pick(rng), pick(rng)});
+    }
 
-        switch (choice)
-         {
-            case 1:
-                // Display all records without formatting
-                std::cout << "\nLoaded Waste Records:\n";
-                std::cout << "--------------------------------------------\n";
-                for (const auto& waste : wasteRecords)
-                {
-                    std::cout << "Type: " << waste.type
-                              << ", Quantity: " << waste.quantity
-                              << ", Location: " << waste.location
-                              << ", Date: " << waste.date
-                              << ", Condition: " << waste.condition << '\n';
-                }
-                std::cout << "--------------------------------------------\n";
-                break;
+    const std::pair<RouteAlgorithm, const char*> algorithms[] = {
+        {RouteAlgorithm::Dijkstra, "Dijkstra (full)"},
+        {RouteAlgorithm::EarlyExit, "Early exit"},
+        {RouteAlgorithm::Bidirectional, "Bidirectional"},
+        {RouteAlgorithm::AStar, "A*"},
+        {RouteAlgorithm::Hierarchy, "Contraction hier."}};
 
-            case 2:
-            {
-                // Filter records by condition
-                std::string conditionFilter;
-                std::cout << "Enter the condition to filter by (e.g., clean, contaminated): ";
-                std::cin.ignore(); // Clear input buffer before reading string
-                std::getline(std::cin, conditionFilter);
+    std::vector<int> reference(queries, -1);
 
-                bool found = false;
-                std::cout << "\nFiltered Waste Records by Condition (" << conditionFilter << "):\n";
-                std::cout << "--------------------------------------------\n";
-                for (const auto& waste : wasteRecords)
-                {
-                    if (waste.condition == conditionFilter)
-                    {
-                        std::cout << "Type: " << waste.type
-                                  << ", Quantity: " << waste.quantity
-                                  << ", Location: " << waste.location
-                                  << ", Date: " << waste.date
-                                  << ", Condition: " << waste.condition << '\n';
-                        found = true;
-                    }
-                }
-                if (!found)
-                {
-                    std::cout << "No records found for condition: " << conditionFilter << '\n';
-                }
-                std::cout << "--------------------------------------------\n";
-                break;
-            }
+    std::cout << "Road network: " << n << " areas, " << queries << " random queries" << std::endl;
+    std::cout << std::left << std::setw(20) << "Algorithm" << std::setw(20) << "Settled per query"
+              << std::setw(16) << "ms per query" << "Mismatches" << std::endl;
+    std::cout << std::string(66, '-') << std::endl;
 
-            case 3:
-                {
-                // Filter records by location
-                std::string locationFilter;
-                std::cout << "Enter the location to filter by: ";
-                std::cin.ignore(); // Clear input buffer before reading string
-                std::getline(std::cin, locationFilter);
+    for (const auto& [algorithm, name] : algorithms)
+    {
+        if (algorithm == RouteAlgorithm::Hierarchy && !network.hasContractionHierarchy())
+        {
+            std::cout << std::left << std::setw(20) << name << "not built (ch-build)" << std::endl;
+            continue;
+        }
 
-                bool found = false;
-                std::cout << "\nFiltered Waste Records by Location (" << locationFilter << "):\n";
-                std::cout << "--------------------------------------------\n";
-                for (const auto& waste : wasteRecords)
-                 {
-                    if (waste.location == locationFilter)
-                    {
-                        std::cout << "Type: " << waste.type
-                                  << ", Quantity: " << waste.quantity
-                                  << ", Location: " << waste.location
-                                  << ", Date: " << waste.date
-                                  << ", Condition: " << waste.condition << '\n';
-                        found = true;
-                    }
-                }
-                if (!found)
-                {
-                    std::cout << "No records found for location: " << locationFilter << '\n';
-                }
-                std::cout << "--------------------------------------------\n";
-                break;
-            }
+        long long settledTotal = 0;
+        int mismatches = 0;
 
-            case 4:
-            {
-                // View waste records in table format
-                std::cout << "\nWaste Records in Table Format:\n";
-                std::cout << std::setw(15) << std::left << "Type"
-                          << std::setw(10) << "Quantity"
-                          << std::setw(20) << "Location"
-                          << std::setw(15) << "Date"
-                          << std::setw(15) << "Condition" << '\n';
-                std::cout << "--------------------------------------------------------\n";
+        auto start = std::chrono::steady_clock::now();
+        for (int q = 0; q < queries; q++)
+        {
+            int distance = -1;
+            long long settled = 0;
+            std::vector<int> path = network.routeQuery(pairs[q].first, pairs[q].second, algorithm, distance, settled);
+            settledTotal += settled;
 
-                for (const auto& waste : wasteRecords)
-                {
-                    std::cout << std::setw(15) << std::left << waste.type
-                              << std::setw(10) << waste.quantity
-                              << std::setw(20) << waste.location
-                              << std::setw(15) << waste.date
-                              << std::setw(15) << waste.condition << '\n';
-                }
-                std::cout << "--------------------------------------------------------\n";
-                break;
+            int length = path.empty() ? -1 : distance;
+            if (algorithm == RouteAlgorithm::Dijkstra)
+            {
+                reference[q] = length;
+            }
+            else if (length != reference[q])
+            {
+                mismatches++;
             }
-
-            case 5:
-                // Exit the display records loop
-                continueDisplaying = false;
-                break;
-
-            default:
-                std::cout << "Invalid choice. Please try again.\n";
         }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / queries;
+
+        std::cout << std::left << std::setw(20) << name << std::setw(20) << settledTotal / queries
+                  << std::setw(16) << ms << mismatches << std::endl;
     }
 }
 
-//Using linear search algorithm
-// Function to search for waste by type with enhancements
-void searchWasteByType()
+
+// Benchmark: close random roads and reopen them, timing the in-place repair of the
+// all-pairs table against rebuilding it, and checking repaired routes against Dijkstra
+void benchmarkRoadClosures(BelgaumWasteManagement& network, int closures)
 {
-    if (wasteRecords.empty())
+    std::vector<RoadEdge> roads = network.getRoads();
+    int n = network.getAreaCount();
+    if (roads.empty() || closures <= 0)
     {
-        std::cout << "No waste records available for searching!\n";
         return;
     }
 
-    std::string searchType;
-    char searchOption;
-
-    // Prompt user for the type of search
-    std::cout << "Enter the type of waste to search for: ";
-    std::cin.ignore();  // To ignore any extra newline characters
-    std::getline(std::cin, searchType);
+    // Make sure the table is current so the edits below repair it rather than drop it
+    int unused = 0;
+    network.shortestPath(0, 0, unused);
 
-    // Ask the user if they want a case-insensitive search
-    std::cout << "Would you like to perform a case-insensitive search? (y/n): ";
-    std::cin >> searchOption;
+    auto start = std::chrono::steady_clock::now();
+    network.buildAllPairsShortestPaths();
+    double rebuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 
-    bool found = false;
-    std::cout << "\nSearch Results:\n";
-    std::cout << "--------------------------------------------\n";
+    std::mt19937 rng(12);
+    std::uniform_int_distribution<int> pickRoad(0, static_cast<int>(roads.size()) - 1);
+    std::uniform_int_distribution<int> pickArea(0, n - 1);
+    double closeMs = 0, reopenMs = 0;
+    int mismatches = 0;
 
-    // Perform search with case-insensitive option if selected
-    for (const auto& waste : wasteRecords)
+    auto check = [&]()
     {
-        bool match = false;
-
-        // Case-insensitive comparison if selected by user
-        if (searchOption == 'y' || searchOption == 'Y')
+        int source = pickArea(rng);
+        std::vector<int> parent;
+        std::vector<int> reference = network.dijkstra(source, source, parent);
+        for (int target = 0; target < n; target++)
         {
-            std::string wasteTypeLower = waste.type;
-            std::transform(wasteTypeLower.begin(), wasteTypeLower.end(), wasteTypeLower.begin(), ::tolower);
-            std::string searchTypeLower = searchType;
-            std::transform(searchTypeLower.begin(), searchTypeLower.end(), searchTypeLower.begin(), ::tolower);
-
-            match = (wasteTypeLower == searchTypeLower);
-        }
-         else
-        {
-            match = (waste.type == searchType);
-        }
-
-        // If there's a match, display the waste record
-        if (match)
-        {
-            std::cout << "Type: " << waste.type
-                      << ", Quantity: " << waste.quantity
-                      << ", Location: " << waste.location
-                      << ", Date: " << waste.date
-                      << ", Condition: " << waste.condition << '\n';
-            found = true;
+            int distance = 0;
+            std::vector<int> path = network.shortestPath(source, target, distance);
+            int expected = reference[target];
+            if ((path.empty() ? std::numeric_limits<int>::max() : distance) != expected)
+                mismatches++;
         }
-    }
+    };
 
-    // If no records were found
-    if (!found)
+    for (int c = 0; c < closures; c++)
     {
-        std::cout << "No records found for waste type: " << searchType << '\n';
+        RoadEdge road = roads[pickRoad(rng)];
+        int weight = network.directRoadWeight(road.from, road.to);
+
+        start = std::chrono::steady_clock::now();
+        network.removeRoad(road.from, road.to);
+        closeMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        check();
+
+        start = std::chrono::steady_clock::now();
+        network.addRoad(road.from, road.to, weight);
+        reopenMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        check();
     }
 
-    std::cout << "--------------------------------------------\n";
+    std::cout << "Road network: " << n << " areas, " << closures << " random closures" << std::endl;
+    std::cout << "Full all-pairs rebuild : " << rebuildMs << " ms" << std::endl;
+    std::cout << "Repair after closing   : " << closeMs / closures << " ms per road" << std::endl;
+    std::cout << "Repair after reopening : " << reopenMs / closures << " ms per road" << std::endl;
+    std::cout << "Mismatches against Dijkstra: " << mismatches << std::endl;
 }
 
 
-// Function to sort waste records by quantity
-void sortWasteRecords()
+// Benchmark: per-date cost of parseDate against the std::regex check it replaced, both
+// with the regex built per call (as isValidDate did) and built once
+void benchmarkDateParsing(int count)
 {
-    if (wasteRecords.empty())
+    if (count <= 0)
     {
-        std::cout << "No waste records available for sorting!\n";
         return;
     }
 
-    int choice;
-    std::cout << "\nSelect the sorting order:\n";
-    std::cout << "1. Sort by Quantity (Descending)\n";
-    std::cout << "2. Sort by Quantity (Ascending)\n";
-    std::cout << "3. Sort by Type (Alphabetical)\n";
-    std::cout << "4. Sort by Location (Alphabetical)\n";
-    std::cout << "Enter your choice (1-4): ";
-    std::cin >> choice;
-
-    switch (choice)
+    // Mostly real dates, some impossible ones (31/02, 29/02 in common years) and some malformed
+    std::mt19937 rng(15);
+    std::vector<std::string> dates;
+    dates.reserve(count);
+    for (int k = 0; k < count; k++)
     {
-        case 1:
-            std::cout << "Sorting waste records by quantity (Descending)...\n";
-            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
-                return a.quantity > b.quantity;  // Sort in descending order
-            });
-            break;
-        case 2:
-            std::cout << "Sorting waste records by quantity (Ascending)...\n";
-            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
-                return a.quantity < b.quantity;  // Sort in ascending order
-            });
-            break;
-        case 3:
-            std::cout << "Sorting waste records by type (Alphabetical)...\n";
-            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
-                return a.type < b.type;  // Sort alphabetically by type
-            });
-            break;
-        case 4:
-            std::cout << "Sorting waste records by location (Alphabetical)...\n";
-            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
-                return a.location < b.location;  // Sort alphabetically by location
-            });
-            break;
-        default:
-            std::cout << "Invalid choice. No sorting applied.\n";
-            return;
+        char text[32];
+        std::snprintf(text, sizeof(text), "%02d/%02d/%04d", static_cast<int>(rng() % 31 + 1),
+                      static_cast<int>(rng() % 12 + 1), static_cast<int>(rng() % 200 + 1900));
+        dates.push_back(text);
+        if (rng() % 20 == 0)
+        {
+            dates.back()[rng() % 10] = 'x';
+        }
     }
 
-    std::cout << "Records sorted successfully!\n";
-    displayWasteRecords();  // Display the sorted records after sorting
+    auto time = [&dates](auto check, std::size_t limit, int& valid)
+    {
+        valid = 0;
+        limit = std::min(limit, dates.size());
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t k = 0; k < limit; k++)
+        {
+            valid += check(dates[k]);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / limit;
+    };
+
+    const char* pattern = R"(\b(0[1-9]|[12][0-9]|3[01])/(0[1-9]|1[0-2])/([0-9]{4})\b)";
+    const std::regex compiled(pattern);
+    int parsedValid = 0, perCallValid = 0, compiledValid = 0;
+    double parsedNs = time([](const std::string& date) { int day; return parseDate(date, DateFormat::DayMonthYear, day); },
+                           dates.size(), parsedValid);
+    // Building a regex per call is slow enough that a sample is plenty
+    double perCallNs = time([pattern](const std::string& date) { return std::regex_match(date, std::regex(pattern)); },
+                            2000, perCallValid);
+    double compiledNs = time([&compiled](const std::string& date) { return std::regex_match(date, compiled); },
+                             dates.size(), compiledValid);
+
+    std::cout << "Dates: " << dates.size() << " (dd/mm/yyyy)" << std::endl;
+    std::cout << std::left << std::setw(28) << "Validator" << std::setw(16) << "ns per date" << "Accepted" << std::endl;
+    std::cout << std::string(54, '-') << std::endl;
+    std::cout << std::left << std::setw(28) << "parseDate" << std::setw(16) << parsedNs << parsedValid << std::endl;
+    std::cout << std::left << std::setw(28) << "regex built per call" << std::setw(16) << perCallNs
+              << perCallValid << " of first " << std::min<std::size_t>(2000, dates.size()) << std::endl;
+    std::cout << std::left << std::setw(28) << "regex built once" << std::setw(16) << compiledNs
+              << compiledValid << " (no month-length check)" << std::endl;
 }
 
-// Function to evaluate composting feasibility for organic waste
-void evaluateWasteCompostingFeasibility()
+
+// One row of the simulation table printed by the simulate commands
+void printSimulationReport(const std::string& policy, const SimulationReport& report)
 {
-    int organicWaste = 0;
+    double hours = (report.endMinute - report.startMinute) / 60;
+    double tonnesPerHour = hours > 0 ? report.collectedKg / 1000.0 / hours : 0;
+    double utilization = hours > 0 && report.vehicleCount > 0
+                             ? 100 * report.busyVehicleMinutes / (report.vehicleCount * hours * 60) : 0;
+    double averageWait = report.served > 0 ? report.totalWaitMinutes / report.served : 0;
+
+    std::cout << std::left << std::setw(12) << policy
+              << std::setw(14) << (std::to_string(report.served) + "/" + std::to_string(report.arrived))
+              << std::setw(10) << report.rejected << std::setw(13) << tonnesPerHour
+              << std::setw(15) << utilization << std::setw(15) << averageWait
+              << std::setw(13) << report.maxWaitMinutes << formatClockTime(report.endMinute) << std::endl;
+}
 
-    for (const auto& waste : wasteRecords)
+
+void printSimulationHeader()
+{
+    std::cout << std::left << std::setw(12) << "Policy" << std::setw(14) << "Served" << std::setw(10) << "Rejected"
+              << std::setw(13) << "Tonnes/hour" << std::setw(15) << "Utilization %" << std::setw(15) << "Avg wait min"
+              << std::setw(13) << "Max wait min" << "Last return" << std::endl;
+    std::cout << std::string(104, '-') << std::endl;
+}
+
+
+// A random day: piles reported uniformly between 06:00 and 18:00 at random areas other
+// than Kanabargi, 500 - 10000 kg each
+std::vector<WasteArrival> randomArrivals(int areaCount, int piles, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> minute(6 * 60, 18 * 60);
+    std::uniform_int_distribution<int> area(1, areaCount - 1);
+    std::uniform_int_distribution<int> quantity(500, 10000);
+    std::vector<WasteArrival> arrivals;
+    for (int k = 0; k < piles; k++)
+    {
+        double at = minute(rng);
+        int where = area(rng);
+        arrivals.push_back({at, where, quantity(rng)});
+    }
+    return arrivals;
+}
+
+
+// Simulates a random day under both policies, so the policies and the current fleet
+// size can be compared on identical arrivals
+void simulateRandomDay(BelgaumWasteManagement& network, int piles, unsigned seed)
+{
+    int n = network.getAreaCount();
+    if (n < 2 || piles <= 0)
     {
-        if (waste.type == "organic")
-        {
-            organicWaste += waste.quantity;
-        }
+        return;
     }
 
-    if (organicWaste > 100)
+    std::vector<WasteArrival> arrivals = randomArrivals(n, piles, seed);
+
+    std::cout << "Simulated day: " << piles << " piles, seed " << seed << std::endl;
+    printSimulationHeader();
+    printSimulationReport("first-fit", network.simulateDay(arrivals, AllocationPolicy::FirstFit));
+    printSimulationReport("best-fit", network.simulateDay(arrivals, AllocationPolicy::BestFit));
+}
+
+
+// Simulates every scenario on the same arrivals using threadCount worker threads. Each
+// worker owns a BelgaumWasteManagement with its own copy of base's road network and
+// routing tables and rebuilds the fleet per scenario; workers take the next scenario
+// from a shared counter and write only their own result slots, so nothing else is shared
+std::vector<SimulationReport> runScenarios(BelgaumWasteManagement& base, const std::vector<Vehicle>& models,
+                                           const std::vector<FleetScenario>& scenarios,
+                                           const std::vector<WasteArrival>& arrivals, AllocationPolicy policy,
+                                           int threadCount)
+{
+    // Bring base's tables up to date once, so every worker can copy rather than rebuild them
+    int unused = 0;
+    base.shortestPath(0, 0, unused);
+
+    std::vector<SimulationReport> results(scenarios.size());
+    std::atomic<std::size_t> next(0);
+    threadCount = std::max(1, std::min(threadCount, static_cast<int>(scenarios.size())));
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; t++)
     {
-        std::cout << "Composting is feasible with " << organicWaste << " kg of organic waste.\n";
+        workers.emplace_back([&]()
+        {
+            BelgaumWasteManagement network;
+            network.copyRoadNetworkFrom(base);
+            for (std::size_t s = next++; s < scenarios.size(); s = next++)
+            {
+                network.resetFleet();
+                for (std::size_t m = 0; m < models.size(); m++)
+                {
+                    for (int c = 0; c < scenarios[s].vehicleCounts[m]; c++)
+                    {
+                        network.addVehicle(models[m]);
+                    }
+                }
+                for (int d = 0; d < scenarios[s].drivers; d++)
+                {
+                    network.addDriver(Driver("Driver " + std::to_string(d + 1), 30, "Belgaum"));
+                }
+                results[s] = network.simulateDay(arrivals, policy);
+            }
+        });
     }
-    else
+    for (std::thread& worker : workers)
     {
-        std::cout << "Insufficient organic waste for composting.\n";
+        worker.join();
     }
+    return results;
 }
 
-// Function to calculate statistics on the waste data
-void calculateStatistics()
+
+// Most scenarios a fleet sweep may store and simulate
+const long long FLEET_SWEEP_LIMIT = 100000;
+
+
+// Number of scenarios fleetMixes would build, or FLEET_SWEEP_LIMIT + 1 once it is over the limit
+long long fleetMixCount(int modelCount, int maxEach, int driversFrom, int driversTo)
 {
-    if (wasteRecords.empty())
+    long long count = static_cast<long long>(driversTo) - driversFrom + 1;
+    for (int m = 0; m < modelCount && count <= FLEET_SWEEP_LIMIT; m++)
     {
-        std::cout << "No records to calculate statistics!\n";
-        return;
+        count *= static_cast<long long>(maxEach) + 1;
     }
+    return (std::min)(count, FLEET_SWEEP_LIMIT + 1);
+}
 
-    // Initializing variables to calculate statistics
-    int totalQuantity = 0;
-    int totalTypes = 0;
-    int highestQuantity = std::numeric_limits<int>::min();
-    int lowestQuantity = std::numeric_limits<int>::max();
-    std::string highestType, lowestType;
-    std::map<std::string, int> typeCounts;
-    std::map<std::string, int> locationCounts;
 
-    // Loop through the records and calculate statistics
-    for (const auto& waste : wasteRecords)
+// Every mix of 0 - maxEach vehicles of each catalogue model, for each driver count
+std::vector<FleetScenario> fleetMixes(int modelCount, int maxEach, int driversFrom, int driversTo)
+{
+    std::vector<FleetScenario> scenarios;
+    std::vector<int> counts(modelCount, 0);
+    while (true)
     {
-        totalQuantity += waste.quantity;
-        typeCounts[waste.type] += waste.quantity;
-        locationCounts[waste.location] += waste.quantity;
-
-        if (waste.quantity > highestQuantity)
+        for (int drivers = driversFrom; drivers <= driversTo; drivers++)
         {
-            highestQuantity = waste.quantity;
-            highestType = waste.type;
+            scenarios.push_back({counts, drivers});
         }
 
-        if (waste.quantity < lowestQuantity)
+        // Next mix, counting in base maxEach + 1
+        int m = 0;
+        while (m < modelCount && counts[m] == maxEach)
         {
-            lowestQuantity = waste.quantity;
-            lowestType = waste.type;
+            counts[m++] = 0;
         }
+        if (m == modelCount)
+            break;
+        counts[m]++;
     }
+    return scenarios;
+}
 
-    // Calculating average quantity
-    double averageQuantity = static_cast<double>(totalQuantity) / wasteRecords.size();
 
-    std::cout << "\nWaste Statistics:\n";
-    std::cout << "--------------------------------------------\n";
-    std::cout << "Total Waste Quantity: " << totalQuantity << " kg\n";
-    std::cout << "Average Waste Quantity: " << averageQuantity << " kg\n";
+// Runs a fleet sweep and prints the best mixes: most piles served, then shortest average
+// wait, then least fuel
+void runFleetSweep(BelgaumWasteManagement& base, const std::vector<Vehicle>& models, int piles, int maxEach,
+                   int driversFrom, int driversTo, int threadCount)
+{
+    std::vector<FleetScenario> scenarios = fleetMixes(models.size(), maxEach, driversFrom, driversTo);
+    std::vector<WasteArrival> arrivals = randomArrivals(base.getAreaCount(), piles, 17);
 
-    // Displaying waste quantities by type
-    std::cout << "Waste Quantities by Type:\n";
-    for (const auto& typeCount : typeCounts)
-    {
-        std::cout << "Type: " << typeCount.first << ", Quantity: " << typeCount.second << " kg\n";
-    }
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SimulationReport> results = runScenarios(base, models, scenarios, arrivals, AllocationPolicy::BestFit, threadCount);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
-    // Displaying waste quantities by location
-    std::cout << "\nWaste Quantities by Location:\n";
-    for (const auto& locationCount : locationCounts)
+    std::vector<int> order(scenarios.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto averageWait = [&results](int s) { return results[s].served ? results[s].totalWaitMinutes / results[s].served : 0; };
+    std::sort(order.begin(), order.end(), [&](int a, int b)
     {
-        std::cout << "Location: " << locationCount.first << ", Quantity: " << locationCount.second << " kg\n";
-    }
-
-    // Displaying waste type with the highest quantity
-    std::cout << "\nType with the Highest Quantity:\n";
-    std::cout << "Type: " << highestType << ", Quantity: " << highestQuantity << " kg\n";
-
-    // Displaying waste type with the lowest quantity
-    std::cout << "\nType with the Lowest Quantity:\n";
-    std::cout << "Type: " << lowestType << ", Quantity: " << lowestQuantity << " kg\n";
-
-    std::cout << "--------------------------------------------\n";
-}
+        if (results[a].served != results[b].served) return results[a].served > results[b].served;
+        if (averageWait(a) != averageWait(b)) return averageWait(a) < averageWait(b);
+        return results[a].fuelLiters < results[b].fuelLiters;
+    });
 
-// Function to implement waste trading between regions
-void implementWasteTrading1()
- {
-    std::map<std::string, int> regionWaste = {
-        {"Region 1", 500},
-        {"Region 2", 700},
-        {"Region 3", 300}
-    };
+    std::cout << "Fleet sweep: " << scenarios.size() << " scenarios, " << piles << " piles, " << threadCount
+              << " threads, " << seconds << " s" << std::endl;
+    std::cout << std::left << std::setw(10) << "Served" << std::setw(10) << "Drivers" << std::setw(14) << "Avg wait min"
+              << std::setw(12) << "Fuel L" << std::setw(12) << "Distance" << std::setw(15) << "Utilization %" << "Fleet" << std::endl;
+    std::cout << std::string(100, '-') << std::endl;
+    for (std::size_t k = 0; k < std::min<std::size_t>(10, order.size()); k++)
+    {
+        const FleetScenario& scenario = scenarios[order[k]];
+        const SimulationReport& report = results[order[k]];
+        std::string fleet;
+        for (std::size_t m = 0; m < models.size(); m++)
+        {
+            if (scenario.vehicleCounts[m] > 0)
+                fleet += (fleet.empty() ? "" : ", ") + std::to_string(scenario.vehicleCounts[m]) + "x " + models[m].vehicleModel;
+        }
+        double hours = (report.endMinute - report.startMinute) / 60;
+        double utilization = hours > 0 && report.vehicleCount > 0
+                                 ? 100 * report.busyVehicleMinutes / (report.vehicleCount * hours * 60) : 0;
 
-    std::cout << "Waste Trading Opportunities:\n";
-    for (const auto& region : regionWaste)
-    {
-        std::cout << region.first << " has " << region.second << " kg of waste available for trading.\n";
+        std::cout << std::left << std::setw(10) << (std::to_string(report.served) + "/" + std::to_string(report.arrived))
+                  << std::setw(10) << scenario.drivers << std::setw(14) << averageWait(order[k])
+                  << std::setw(12) << report.fuelLiters << std::setw(12) << report.distanceKm
+                  << std::setw(15) << utilization << (fleet.empty() ? "(none)" : fleet) << std::endl;
     }
 }
 
 
-// Function to send waste to a factory
-
-#include <algorithm>  // For std::transform
-#include <cctype>     // For std::tolower, std::toupper
-
-//Using linear search algorithm
-// Function to send waste to a factory
-void sendWasteToFactory()
+// Benchmark: the same fleet sweep with 1, 2, 4, ... threads up to the hardware thread
+// count, checking that every run gives the same results
+bool benchmarkScenarioRunner(BelgaumWasteManagement& base, int piles)
 {
-    // Check if there are any waste records to send
-    if (wasteRecords.empty())
+    std::vector<Vehicle> models = base.getVehicleModels();
+    if (models.size() > 3)
+        models.erase(models.begin() + 3, models.end());
+    if (models.empty())
     {
-        std::cout << "No waste records available to send to the factory!\n";
-        return;
+        std::cout << "The scenario runner needs a fleet; load one first (fleet default).\n";
+        return false;
+    }
+    if (base.getAreaCount() < 2)
+    {
+        std::cout << "The scenario runner needs a road network with at least two areas.\n";
+        return false;
     }
 
-    // Get the type of waste the user wants to send (case insensitive)
-    std::string wasteType;
-    std::cout << "Enter the type of waste to send to the factory: ";
-    std::cin.ignore();  // Clear any leftover newline character
-    std::getline(std::cin, wasteType);
+    std::vector<FleetScenario> scenarios = fleetMixes(models.size(), 4, 2, 6);
+    std::vector<WasteArrival> arrivals = randomArrivals(base.getAreaCount(), piles, 17);
+    int hardware = std::max(1u, std::thread::hardware_concurrency());
 
-    // Convert the input to lowercase to make it case insensitive
-    std::transform(wasteType.begin(), wasteType.end(), wasteType.begin(), [](unsigned char c){ return std::tolower(c); });
+    std::cout << "Scenario runner: " << scenarios.size() << " scenarios, " << piles << " piles, "
+              << hardware << " hardware threads" << std::endl;
+    std::cout << std::left << std::setw(10) << "Threads" << std::setw(14) << "Seconds" << std::setw(10) << "Speedup"
+              << "Differences" << std::endl;
+    std::cout << std::string(46, '-') << std::endl;
 
-    // Calculate the total available quantity for the specified waste type
-    int totalQuantity = 0;
-    for (const auto& waste : wasteRecords)
+    std::vector<SimulationReport> reference;
+    double oneThread = 0;
+    for (int threads = 1; ; threads = std::min(threads * 2, hardware))
     {
-        // Convert waste type to lowercase for comparison
-        std::string recordType = waste.type;
-        std::transform(recordType.begin(), recordType.end(), recordType.begin(), [](unsigned char c){ return std::tolower(c); });
+        auto start = std::chrono::steady_clock::now();
+        std::vector<SimulationReport> results = runScenarios(base, models, scenarios, arrivals, AllocationPolicy::BestFit, threads);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
-        if (recordType == wasteType)
+        int differences = 0;
+        if (reference.empty())
         {
-            totalQuantity += waste.quantity;
+            reference = results;
+            oneThread = seconds;
+        }
+        for (std::size_t s = 0; s < results.size(); s++)
+        {
+            differences += results[s].served != reference[s].served || results[s].fuelLiters != reference[s].fuelLiters ||
+                           results[s].totalWaitMinutes != reference[s].totalWaitMinutes;
         }
-    }
 
-    // If no records of the specified waste type exist
-    if (totalQuantity == 0)
-    {
-        std::cout << "No waste of type '" << wasteType << "' available for sending.\n";
-        return;
+        std::cout << std::left << std::setw(10) << threads << std::setw(14) << seconds << std::setw(10)
+                  << oneThread / seconds << differences << std::endl;
+        if (threads == hardware)
+            break;
     }
+    return true;
+}
 
-    // Display the total available quantity of the specified waste type
-    std::cout << "Total available quantity of '" << wasteType << "': " << totalQuantity << " kg.\n";
 
-    // Get the quantity to be sent to the factory
-    int quantityToSend;
-    do
-    {
-        std::cout << "Enter the quantity to send to the factory (between 1 and " << totalQuantity << "): ";
-        std::cin >> quantityToSend;
-        if (quantityToSend <= 0 || quantityToSend > totalQuantity)
-        {
-            std::cout << "Invalid quantity! Please try again.\n";
-        }
-    } while (quantityToSend <= 0 || quantityToSend > totalQuantity);
+// Loads the default Belgaum fleet, drivers and waste piles
+// Shared by the interactive route menu and the batch mode
+void loadDefaultFleet(BelgaumWasteManagement& bwm)
+{
+    // Add Vehicles
+    //vehicle1
+    bwm.addVehicle(Vehicle("Tata Ace", 1000, 13.0));
+    //vehicle2
+    bwm.addVehicle(Vehicle("Mahindra Pickup", 2000, 12.0));
+    //vehicle3
+    bwm.addVehicle(Vehicle("Ashok Leyland Dost", 3000, 14.0));
+    //vehicle4
+    bwm.addVehicle(Vehicle("BharatBenz 1160", 4000, 11.0));
+    //vehicle5
+    bwm.addVehicle(Vehicle("Eicher 950", 6000, 12.0));
+    //vehicle6
+    bwm.addVehicle(Vehicle("Tata Ace Hybrid", 9000, 11.0));
+    //vehicle7
+    bwm.addVehicle(Vehicle("Tata Force", 10000, 10.0));
+    //vehicle8
+    bwm.addVehicle(Vehicle("Leyland Bada Dost", 11000, 9.0));
+    //vehicle9
+    bwm.addVehicle(Vehicle("MAN 1600", 12000, 8.0));
+    //vehicle10
+    bwm.addVehicle(Vehicle("Tata 1630", 14000, 7.0));
+    //All vehicle
 
-    // Get factory details
-    std::string factoryName, factoryLocation;
-    std::cin.ignore();  // Clear the input buffer
-    std::cout << "Enter the factory name: ";
-    std::getline(std::cin, factoryName);
 
-    std::cout << "Enter the factory location: ";
-    std::getline(std::cin, factoryLocation);
+    // Add Drivers
 
-    // Deduct the quantity from waste records and manage remaining quantities
-    int remainingToSend = quantityToSend;  // Track remaining quantity to be deducted
-    for (auto& waste : wasteRecords)
-    {
-        std::string recordType = waste.type;
-        std::transform(recordType.begin(), recordType.end(), recordType.begin(), [](unsigned char c){ return std::tolower(c); });
 
-        if (recordType == wasteType && remainingToSend > 0)
-        {
-            // If the remaining quantity to send is greater than or equal to the waste quantity in this record
-            if (remainingToSend >= waste.quantity)
-            {
-                remainingToSend -= waste.quantity;
-                waste.quantity = 0;  // This waste record is exhausted
-            }
-            else
-            {
-                waste.quantity -= remainingToSend;
-                remainingToSend = 0;  // All required quantity is deducted
-            }
-        }
-    }
 
-    // Add the transaction record to the factory records
-    factoryRecords.push_back({wasteType, quantityToSend, factoryName, factoryLocation});
+    // All drivers
 
-    // Confirmation message
-    std::cout << "Successfully sent " << quantityToSend << " kg of '" << wasteType << "' to " << factoryName
-              << " located at " << factoryLocation << ".\n";
+    bwm.addDriver(Driver("Abhi", 30, "Gokak"));
+    bwm.addDriver(Driver("Arun", 32, "Hubli"));
+    bwm.addDriver(Driver("Akash", 25, "Kanabargi"));
+    bwm.addDriver(Driver("Gagan", 28, "Sambre"));
+    bwm.addDriver(Driver("Venki", 26, "Suldal"));
 
-    // Display remaining quantity of the specified waste type
-    int remainingQuantity = 0;
-    for (const auto& waste : wasteRecords)
-    {
-        std::string recordType = waste.type;
-        std::transform(recordType.begin(), recordType.end(), recordType.begin(), [](unsigned char c){ return std::tolower(c); });
+    // Add Wastes
+    //wastearea1
+    bwm.addWaste(Waste("Kanabargi", 500));
 
-        if (recordType == wasteType)
-        {
-            remainingQuantity += waste.quantity;
-        }
-    }
-    std::cout << "Remaining quantity of '" << wasteType << "': " << remainingQuantity << " kg.\n";
+    //wastearea2
+    bwm.addWaste(Waste("BelgaumCBT", 1000));
 
-    // Ask if the user wants to view the updated waste records
-    char viewChoice;
-    std::cout << "Do you want to view the updated waste records? (y/n): ";
-    std::cin >> viewChoice;
 
-    if (viewChoice == 'y' || viewChoice == 'Y')
-    {
-        displayWasteRecords();  // Display the updated records
-    }
+    //wastearea3
+    bwm.addWaste(Waste("Shivaji Nagar", 1500));
+    //wastearea4
+    bwm.addWaste(Waste("Tilakwadi", 2000));
 
-    // Ask if the user wants to send more waste to the factory
-    char continueChoice;
-    std::cout << "Do you want to send more waste to a factory? (y/n): ";
-    std::cin >> continueChoice;
+    //wastearea5
+    bwm.addWaste(Waste("Chennamma Nagar", 2500));
 
-    if (continueChoice == 'y' || continueChoice == 'Y')
-    {
-        sendWasteToFactory();  // Recursively call the function to send more waste
-    }
-    else
-    {
-        std::cout << "Returning to the main menu.\n";
-    }
-}
+    //wastearea6
+    bwm.addWaste(Waste("Gandhinagar", 3000));
 
+    //wastearea7
+    bwm.addWaste(Waste("APMC Yard", 3500));
 
+    //wastearea8
+    bwm.addWaste(Waste("City Market", 4000));
 
+    //wastearea9
+    bwm.addWaste(Waste("Fort Road", 4500));
 
+    //wastearea10
+    bwm.addWaste(Waste("Engg College Road", 5000));
 
-// Function to view factory records
-#include <iomanip> // For formatting table display
+    //wastearea11
+    bwm.addWaste(Waste("Khanapur Road", 5500));
 
-// Function to display all factory records
-void displayFactoryRecords()
-{
-    if (factoryRecords.empty())
-    {
-        std::cout << "No factory records to display!\n";
-        return;
-    }
+    //wastearea12
+    bwm.addWaste(Waste("Udyambag", 6000));
 
-    std::cout << "\nAll Factory Records:\n";
-    std::cout << "--------------------------------------------\n";
-    for (const auto& record : factoryRecords)
-    {
-        std::cout << "Type: " << record.wasteType
-                  << ", Quantity: " << record.totalQuantity
-                  << ", Factory: " << record.factoryName
-                  << ", Location: " << record.factoryLocation << '\n';
-    }
-    std::cout << "--------------------------------------------\n";
-}
+    //wastearea13
+    bwm.addWaste(Waste("Bogarves", 6500));
 
-// Function to display factory records by waste type
-void displayFactoryRecordsByType(const std::string& wasteType)
- {
-    bool found = false;
 
-    std::cout << "\nFactory Records for Waste Type: " << wasteType << "\n";
-    std::cout << "--------------------------------------------\n";
-    for (const auto& record : factoryRecords) {
-        if (record.wasteType == wasteType) {
-            std::cout << "Type: " << record.wasteType
-                      << ", Quantity: " << record.totalQuantity
-                      << ", Factory: " << record.factoryName
-                      << ", Location: " << record.factoryLocation << '\n';
-            found = true;
-        }
-    }
-    if (!found)
-    {
-        std::cout << "No records found for waste type: " << wasteType << '\n';
-    }
-    std::cout << "--------------------------------------------\n";
-}
-
-// Function to sort factory records by quantity
-void sortFactoryRecordsByQuantity()
- {
-    std::sort(factoryRecords.begin(), factoryRecords.end(), [](const FactoryRecord& a, const FactoryRecord& b) {
-        return a.totalQuantity > b.totalQuantity;
-    });
-    std::cout << "Factory records sorted by quantity!\n";
-}
+    //wastearea14
+    bwm.addWaste(Waste("Goaves", 7000));
 
-// Function to sort factory records by factory name
-void sortFactoryRecordsByName()
- {
-    std::sort(factoryRecords.begin(), factoryRecords.end(), [](const FactoryRecord& a, const FactoryRecord& b) {
-        return a.factoryName < b.factoryName;
-    });
-    std::cout << "Factory records sorted by factory name!\n";
-}
+    //wastearea15
+    bwm.addWaste(Waste("Hindwadi", 7500));
 
-// Function to sort factory records by location
-void sortFactoryRecordsByLocation()
- {
-    std::sort(factoryRecords.begin(), factoryRecords.end(), [](const FactoryRecord& a, const FactoryRecord& b) {
-        return a.factoryLocation < b.factoryLocation;
-    });
-    std::cout << "Factory records sorted by location!\n";
-}
+    //wastearea16
+    bwm.addWaste(Waste("Mache", 8000));
 
-// Function to display factory records in table format
-void displayFactoryRecordsInTable()
-{
-    if (factoryRecords.empty())
-    {
-        std::cout << "No factory records to display!\n";
-        return;
-    }
+    //wastearea17
+    bwm.addWaste(Waste("Malmaruti", 8500));
 
-    std::cout << "\nFactory Records (Table Format):\n";
-    std::cout << std::left << std::setw(15) << "Waste Type"
-              << std::setw(10) << "Quantity"
-              << std::setw(20) << "Factory Name"
-              << std::setw(15) << "Location" << '\n';
-    std::cout << std::string(60, '-') << '\n';
+    //wastearea18
+    bwm.addWaste(Waste("Nemgoa", 9000));
 
-    for (const auto& record : factoryRecords)
-    {
-        std::cout << std::left << std::setw(15) << record.wasteType
-                  << std::setw(10) << record.totalQuantity
-                  << std::setw(20) << record.factoryName
-                  << std::setw(15) << record.factoryLocation << '\n';
-    }
-    std::cout << std::string(60, '-') << '\n';
-}
+    //wastearea19
+    bwm.addWaste(Waste("Shahpur", 9500));
 
-// Function to export factory records to a CSV file
-void exportFactoryRecordsToCSV()
- {
-    std::string fileName;
-    std::cout << "Enter the file name to save factory records (e.g., factory_records.csv): ";
-    std::cin.ignore(); // Ignore leftover newline
-    std::getline(std::cin, fileName);
+    //wastearea20
+    bwm.addWaste(Waste("Sambhaji Nagar", 10000));
 
-    std::ofstream outFile(fileName);
-    if (!outFile.is_open())
-    {
-        std::cout << "Failed to open file for writing. Please try again.\n";
-        return;
-    }
+    //wastearea21
+    bwm.addWaste(Waste("Angol", 10500));
 
-    // Write CSV headers
-    outFile << "Waste Type,Quantity,Factory Name,Factory Location\n";
+    //wastearea22
+    bwm.addWaste(Waste("Balekundri", 11000));
 
-    // Write each factory record to the CSV file
-    for (const auto& record : factoryRecords)
-    {
-        outFile << record.wasteType << ","
-                << record.totalQuantity << ","
-                << record.factoryName << ","
-                << record.factoryLocation << "\n";
-    }
+    //wastearea23
+    bwm.addWaste(Waste("Camp", 11500));
+    //wastearea24
+    bwm.addWaste(Waste("Dharamnath", 12000));
 
-    outFile.close();
-    std::cout << "Factory records successfully exported to '" << fileName << "'.\n";
+    //wastearea25
+    bwm.addWaste(Waste("Fort Lake", 12500));
 }
-void saveToCSV(const std::string& filePath)
- {
-    std::ofstream file(filePath);
-    if (!file.is_open())
-    {
-        std::cerr << "Error: Could not open file for writing at " << filePath << '\n';
-        return;
-    }
-
-    // Write the header for the CSV file
-    file << "Type,Quantity,Location,Date,Condition\n";
 
-    // Write waste data records to the file
-    for (const auto& waste : wasteRecords)
-    {
-        file << waste.type << ',' << waste.quantity << ',' << waste.location
-             << ',' << waste.date << ',' << waste.condition << '\n';
-    }
 
-    file.close();
-    std::cout << "Data saved successfully to the CSV file!\n";
-}
+int route()
 
-// Complete function to view factory records with menu options
-void viewFactoryRecords()
 {
-    if (factoryRecords.empty())
-    {
-        std::cout << "No factory records to display!\n";
-        return;
-    }
+    BelgaumWasteManagement bwm;
+
+    // Add the default fleet, drivers and waste piles
+    loadDefaultFleet(bwm);
+
+    // Allocations from earlier runs, and a record of the ones made in this run
+    bwm.openAllocationLog(ALLOCATION_LOG_FILE);
 
     int choice;
+
     do
-        {
-        std::cout << "\n=== View Factory Records Menu ===\n";
-        std::cout << "1. View All Factory Records\n";
-        std::cout << "2. View Factory Records by Waste Type\n";
-        std::cout << "3. Sort Factory Records by Quantity\n";
-        std::cout << "4. Sort Factory Records by Factory Name\n";
-        std::cout << "5. Sort Factory Records by Location\n";
-        std::cout << "6. Display Factory Records in Table Format\n";
-        std::cout << "7. Export Factory Records to CSV\n";
-        std::cout << "8. Exit\n";
-        std::cout << "Enter your choice (1-8): ";
+      {
+
+        bwm.displayMenu();
+        std::cout << "Enter your choice: ";
         std::cin >> choice;
 
-        switch (choice) {
-            case 1:
-                displayFactoryRecords();
-                break;
 
-            case 2: {
-                std::string wasteType;
-                std::cout << "Enter the waste type to search for: ";
-                std::cin.ignore(); // Ignore leftover newline
-                std::getline(std::cin, wasteType);
-                displayFactoryRecordsByType(wasteType);
-                break;
-            }
+        // Handle invalid input for menu choice
+        if(std::cin.fail())
+          {
+            std::cin.clear();
+             // clear error flag
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            // ignore invalid input
+            std::cout << "Invalid input. Please enter a valid number.\n";
+            continue;
 
-            case 3:
-                sortFactoryRecordsByQuantity();
-                break;
+        }
 
-            case 4:
-                sortFactoryRecordsByName();
-                break;
+        switch (choice)
+         {
 
-            case 5:
-                sortFactoryRecordsByLocation();
-                break;
+        case 1:
+          {
 
-            case 6:
-                displayFactoryRecordsInTable();
-                break;
+            int wasteIndex;
+             std::cout << "Enter destination area index:\n";
+              std::cout << "1: Kanabargi\n";
+              std::cout << "2: Belgaum\n";
+              std::cout << "3: Shivaji Nagar\n";
+              std::cout << "4: Tilakwadi\n";
+              std::cout << "5: Chennamma Nagar\n";
+              std::cout << "6: Gandhinagar\n";
+              std::cout << "7: APMC Yard\n";
+              std::cout << "8: City Market\n";
+              std::cout << "9: Fort Road\n";
+              std::cout << "10: Engg College Road\n";
+              std::cout << "11: Khanapur Road\n";
+              std::cout << "12: Udyambag\n";
+              std::cout << "13: Bogarves\n";
+              std::cout << "14: Goaves\n";
+              std::cout << "15: Hindwadi\n";
+              std::cout << "16: Mache\n";
+              std::cout << "17: Malmaruti\n";
+              std::cout << "18: Nemgoa\n";
+              std::cout << "19: Shahpur\n";
+              std::cout << "20: Sambhaji Nagar\n";
+              std::cout << "21: Angol\n";
+              std::cout << "22: Balekundri\n";
+              std::cout << "23: Camp\n";
+              std::cout << "24: Dharamnath\n";
+              std::cout << "25: Fort Lake\n";
+            std::cin >> wasteIndex;
+            if(wasteIndex < 1 || wasteIndex > 25)
+              {
 
-            case 7:
-                exportFactoryRecordsToCSV();
-                break;
+                std::cout << "Invalid waste index. Please enter a number between 1 and 25.\n";
+            }
+            else
+              {
 
-            case 8:
-                std::cout << "Exiting the view menu.\n";
-                break;
+                bwm.allotVehicle(wasteIndex - 1);
+            }
 
-            default:
-                std::cout << "Invalid choice. Please try again.\n";
+            break;
         }
-    } while (choice != 8);
-}
 
 
-// Function to update an existing waste record
-void updateWasteRecord()
- {
-    // Prompt user to enter the type of waste they want to update
-    std::string searchType;
-    std::cout << "Enter the type of waste you want to update: ";
-    // To clear the input buffer
-    std::cin.ignore();
-    // Read the waste type to update
-    std::getline(std::cin, searchType);
+        case 2:
+            bwm.displayVehicles();
+            break;
 
-    // Flag to check if waste record is found
-    bool found = false;
 
-    // Loop through waste records to find the matching type
-    for (auto& waste : wasteRecords)
-     {
-        if (waste.type == searchType)
-        {
-            found = true;  // Mark as found
-            std::cout << "Updating record for waste type: " << waste.type << "\n";
-
-            // Ask user to enter new details for the waste record
-            std::cout << "Enter new quantity: ";
-             // Update quantity
-            std::cin >> waste.quantity;
-            while (waste.quantity < 0)
-            {
-                // Validate positive quantity
-                std::cout << "Quantity must be non-negative. Please enter a valid quantity: ";
-                std::cin >> waste.quantity;
-            }
-
-            // Get new location from the user
-            std::cout << "Enter new location: ";
-            // Ignore any extra newline characters
-            std::cin.ignore();
-             // Read the new location
-            std::getline(std::cin, waste.location);
+        case 3:
+            bwm.displayDrivers();
+            break;
 
-            // Get new condition from the user
-            std::cout << "Enter new condition (e.g., clean, contaminated): ";
-            // Read the new condition
-            std::getline(std::cin, waste.condition);
 
-            // Display the updated record to the user
-            std::cout << "Record updated successfully!\n";
-            std::cout << "Updated waste record:\n";
-            std::cout << "Type: " << waste.type
-                      << ", Quantity: " << waste.quantity
-                      << ", Location: " << waste.location
-                      << ", Date: " << waste.date
-                      << ", Condition: " << waste.condition << "\n";
-                        // Exit loop after updating the first match
+        case 4:
+            bwm.displayWastes();
             break;
-        }
-    }
 
-    // If no matching waste type was found
-    if (!found)
-    {
-        std::cout << "No record found with waste type: " << searchType << "\n";
-    }
-}
 
+        case 5:
+           {
 
-// Function to calculate potential energy from waste
-void calculateEnergyFromWaste1()
- {
-    std::map<std::string, int> wasteEnergyPotential = {
-        {"plastic", 1000},
-        {"organic", 800},
-        {"paper", 500},
-        {"metal", 200}
-    };
+            int destination;
+            std::cout << "Enter destination area index (1: Kanabargi, 2: Belgaum, 3: Shivaji Nagar, ... 25: Fort Lake): ";
 
-    int totalEnergy = 0;
+            std::cin >> destination;
 
-    for (const auto& waste : wasteEnergyPotential)
-    {
-        totalEnergy += waste.second;
-    }
+            if(destination < 1 || destination > 25)
+              {
 
-    std::cout << "Total Potential Energy from Waste: " << totalEnergy << " MJ\n";
-}
+                std::cout << "Invalid destination. Please enter a number between 1 and 25.\n";
 
+            }
+             else
+              {
 
-// Function to delete a waste record
-void deleteWasteRecord()
-{
-    // Prompt the user to enter the type of waste to delete
-    std::string searchType;
-    std::cout << "Enter the type of waste you want to delete: ";
-    // Clear any extra input buffer
-    std::cin.ignore();
-    // Read the waste type
-    std::getline(std::cin, searchType);
+                int source = 0; // Kanabargi
+                bwm.findShortestRouteToDestination(source, destination - 1);
+            }
+            break;
+        }
 
-    // Check if there are any records available before trying to delete
-    if (wasteRecords.empty())
-    {
-        std::cout << "No records available to delete.\n";
-        return;
-    }
 
-    // Search for the waste record using std::remove_if to find matching types
-    auto it = std::remove_if(wasteRecords.begin(), wasteRecords.end(),
-        [&searchType](const Wastes& waste) { return waste.type == searchType; });
+        case 6:
+          {
 
-    // If a matching waste type is found, erase the record
-    if (it != wasteRecords.end())
-    {
-        // Erase the record from the vector using the iterator returned by std::remove_if
-        wasteRecords.erase(it, wasteRecords.end());
+            int destination;
+           std::cout << "Enter destination area index:\n";
+              std::cout << "1: Kanabargi\n";
+              std::cout << "2: Belgaum\n";
+              std::cout << "3: Shivaji Nagar\n";
+              std::cout << "4: Tilakwadi\n";
+              std::cout << "5: Chennamma Nagar\n";
+              std::cout << "6: Gandhinagar\n";
+              std::cout << "7: APMC Yard\n";
+              std::cout << "8: City Market\n";
+              std::cout << "9: Fort Road\n";
+              std::cout << "10: Engg College Road\n";
+              std::cout << "11: Khanapur Road\n";
+              std::cout << "12: Udyambag\n";
+              std::cout << "13: Bogarves\n";
+              std::cout << "14: Goaves\n";
+              std::cout << "15: Hindwadi\n";
+              std::cout << "16: Mache\n";
+              std::cout << "17: Malmaruti\n";
+              std::cout << "18: Nemgoa\n";
+              std::cout << "19: Shahpur\n";
+              std::cout << "20: Sambhaji Nagar\n";
+              std::cout << "21: Angol\n";
+              std::cout << "22: Balekundri\n";
+              std::cout << "23: Camp\n";
+              std::cout << "24: Dharamnath\n";
+              std::cout << "25: Fort Lake\n";
+            std::cin >> destination;
+            if(destination < 1 || destination > 25)
+              {
 
-        // Provide user feedback on successful deletion
-        std::cout << "Record for waste type: " << searchType << " deleted successfully!\n";
+                std::cout << "Invalid destination. Please enter a number between 1 and 25.\n";
+            }
+            else
+              {
+                int source = 0;
+                // Kanabargi
 
-        // Display the remaining waste records
-        std::cout << "Updated waste records:\n";
+                bwm.findLongestRouteToDestination(source, destination - 1);
+            }
 
-        for (const auto& waste : wasteRecords)
-        {
-            std::cout << "Type: " << waste.type
-                      << ", Quantity: " << waste.quantity
-                      << ", Location: " << waste.location
-                      << ", Date: " << waste.date
-                      << ", Condition: " << waste.condition << "\n";
+            break;
         }
-    }
 
-     else
-    {
-        // If no matching waste record was found, notify the user
-        std::cout << "No record found with waste type: " << searchType << "\n";
-    }
+        case 7:
+            bwm.viewAvailableVehiclesAndDrivers();
+            break;
 
-    // Optionally, you can implement a confirmation prompt to ask the user if they want to delete multiple records or go back
-    char confirmDeletion;
-    std::cout << "Do you want to delete another waste record? (Y/N): ";
-    std::cin >> confirmDeletion;
 
-    if (confirmDeletion == 'Y' || confirmDeletion == 'y')
-    {
-        // Recursive call to allow the user to delete more records if desired
-        deleteWasteRecord();
-    }
+        case 8:
+            bwm.displayCollectedWasteByDate();
+            break;
 
-    else
-    {
-        // Optionally, return to the main menu or end the operation
-        std::cout << "Returning to the main menu.\n";
-    }
-}
 
-// Function to add a new waste record
-// Function to add a new waste record
-void addNewWasteRecord()
- {
-    // Declare a new waste record object to be added
-    Wastes newWaste;
+        case 9:
+            bwm.storeDataInFile();
 
-    // Ask the user to enter waste type
-    std::cout << "Enter waste type: ";
-     // Clear any extra input buffer
-    std::cin.ignore();
-     // Read the type of waste
-    std::getline(std::cin, newWaste.type);
+            break;
 
-    // Validate that waste type is not empty
-    if (newWaste.type.empty())
-    {
-        std::cout << "Error: Waste type cannot be empty.\n";
-        return;  // Exit if waste type is empty
-    }
 
-    // Ask the user to enter quantity
-    std::cout << "Enter quantity (in kg): ";
-    std::cin >> newWaste.quantity;
 
-    // Validate that quantity is a positive number
-    if (newWaste.quantity <= 0)
-    {
-        std::cout << "Error: Quantity must be greater than zero.\n";
-        // Exit if the quantity is invalid
-        return;
-    }
+        case 10:
 
-    // Ask the user to enter location
-    std::cout << "Enter location: ";
+          {
 
-     // Clear the input buffer
-    std::cin.ignore();
-    // Read the location of the waste
-    std::getline(std::cin, newWaste.location);
+            bwm.loadDataFromFile(ALLOCATION_LOG_FILE);
+            break;
+        }
 
-    // Validate that location is not empty
 
-    if (newWaste.location.empty())
-    {
-        std::cout << "Error: Location cannot be empty.\n";
-         // Exit if location is empty
-        return;
-    }
 
-    // Ask the user to enter the date of the waste record
-    std::cout << "Enter date (YYYY-MM-DD): ";
-    std::getline(std::cin, newWaste.date);  // Read the date
+        case 11:
+            std::cout << "Exiting the program." << std::endl;
+            break;
 
-    // Validate that the date is in correct format (YYYY-MM-DD)
-    std::regex datePattern(R"(\d{4}-\d{2}-\d{2})");
+        default:
 
-    if (!std::regex_match(newWaste.date, datePattern))
-    {
-        std::cout << "Error: Date format must be YYYY-MM-DD.\n";
-    // Exit if the date format is incorrect
-        return;
-    }
+            std::cout << "Invalid choice. Please try again." << std::endl;
+        }
 
-    // Ask the user to enter the condition of the waste
-    std::cout << "Enter condition (e.g.,Recyclable,Non-Recyclable,Compostable): ";
 
-    // Read the condition
-    std::getline(std::cin, newWaste.condition);
-    // Validate that condition is not empty
-    if (newWaste.condition.empty())
-    {
-        std::cout << "Error: Condition cannot be empty.\n";
-        // Exit if condition is empty
-        return;
+    } while (choice != 11);
+
+
+    return 0;
+
+
+}
+
+
+//module1
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <map>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <array>
+#include <sstream>
+#include <chrono>
+#include <filesystem>
+#include <cmath>
+#include <limits>
+#include <random>
+// SSE2 comes with every x86-64 target; the statistics kernels use plain loops elsewhere
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AREA_STATS_SSE2
+#endif
+
+using namespace std;
+
+// A problem found while reading a CSV file, with the line the record starts on
+struct CsvError
+{
+    size_t line;
+    string message;
+};
+
+
+// A CSV file read in place through a memory mapping, which it keeps open: fields are
+// string_views into the mapped bytes. Fields may be quoted ("...") to hold commas and
+// line breaks, with "" standing for one quote; only those fields are unescaped into text
+// of their own. A trailing \r is dropped (CRLF files) and blank lines are skipped
+class CsvFile
+{
+public:
+    bool open(const string& filename)
+    {
+        file = make_unique<MappedFile>(filename);
+        unescaped.clear();
+        return file->isOpen();
     }
 
-    // Add the new waste record to the vector of records
-    wasteRecords.push_back(newWaste);
+    size_t size() const { return file ? file->size() : 0; }
 
-    // Provide feedback to the user about the success of the operation
-    std::cout << "New waste record added successfully!\n";
+    // Line breaks in the file: an upper bound on the records, less one, for reserving
+    size_t lineBreaks() const { return count(file->data(), file->data() + file->size(), '\n'); }
 
-    // Optional: Ask the user if they want to add another record
-    char confirmAdd;
+    // Calls onRecord(line, fields) for each record, line being where it starts. A quote
+    // that is never closed or text after a closing quote is added to errors instead
+    template <typename OnRecord>
+    void forEachRecord(OnRecord onRecord, vector<CsvError>& errors)
+    {
+        const char* at = file->data();
+        const char* end = at + file->size();
+        size_t line = 1;
+        vector<string_view> fields;
+        while (at < end)
+        {
+            size_t recordLine = line;
+            fields.clear();
+            bool bad = false;
+            for (;;)
+            {
+                if (at < end && *at == '"')
+                {
+                    bad = !readQuoted(at, end, line, fields, recordLine, errors);
+                }
+                else
+                {
+                    const char* start = at;
+                    while (at < end && *at != ',' && *at != '\n')
+                        ++at;
+                    const char* stop = at;
+                    if ((at == end || *at == '\n') && stop > start && stop[-1] == '\r')
+                        --stop;
+                    fields.emplace_back(start, stop - start);
+                }
 
-    std::cout << "Do you want to add another waste record? (Y/N): ";
-    std::cin >> confirmAdd;
+                if (bad || at == end || *at == '\n')
+                    break;
+                ++at;   // the comma
+            }
 
-    if (confirmAdd == 'Y' || confirmAdd == 'y')
+            if (bad)
+            {
+                // Resume on the next line
+                while (at < end && *at != '\n')
+                    ++at;
+            }
+            else if (fields.size() > 1 || !fields[0].empty())
+            {
+                onRecord(recordLine, fields);
+            }
+            if (at < end)
+            {
+                ++at;
+                ++line;
+            }
+        }
+    }
+
+private:
+    unique_ptr<MappedFile> file;
+    // A deque never moves its strings, so views of them stay valid
+    deque<string> unescaped;
+
+    string_view keep(string text)
     {
-        // Recursively call the function to allow adding another record
-        addNewWasteRecord();
+        unescaped.push_back(move(text));
+        return unescaped.back();
     }
 
-    else
+    // Reads a quoted field starting at the opening quote and stops on the comma or line
+    // break after it; false (with an error) if it is malformed
+    bool readQuoted(const char*& at, const char* end, size_t& line, vector<string_view>& fields,
+                    size_t recordLine, vector<CsvError>& errors)
     {
-        // Optionally, return to the main menu or end the operation
-        std::cout << "Returning to the main menu.\n";
+        const char* start = ++at;
+        string text;
+        bool escaped = false;
+        for (;;)
+        {
+            const char* quote = static_cast<const char*>(memchr(at, '"', end - at));
+            if (quote == nullptr)
+            {
+                errors.push_back({recordLine, "quoted field is never closed"});
+                at = end;
+                return false;
+            }
+            line += count(at, quote, '\n');
+            if (quote + 1 < end && quote[1] == '"')
+            {
+                text.append(at, quote + 1);
+                escaped = true;
+                at = quote + 2;
+                continue;
+            }
+
+            if (escaped)
+            {
+                text.append(at, quote);
+                fields.push_back(keep(move(text)));
+            }
+            else
+            {
+                fields.emplace_back(start, quote - start);
+            }
+            at = quote + 1;
+            if (at < end && *at == '\r' && at + 1 < end && at[1] == '\n')
+                ++at;
+            if (at < end && *at != ',' && *at != '\n')
+            {
+                errors.push_back({recordLine, "text after a closing quote"});
+                return false;
+            }
+            return true;
+        }
     }
+};
 
-    // Optionally, print the updated list of waste records
-    std::cout << "Updated waste records:\n";
-    for (const auto& waste : wasteRecords)
+
+// Prints the errors from reading filename together, the first few in full
+void printCsvErrors(const string& filename, size_t records, const vector<CsvError>& errors)
+{
+    if (errors.empty())
+        return;
+
+    const size_t shown = 10;
+    cout << errors.size() << " of " << records + errors.size() << " records in \"" << filename << "\" could not be read:\n";
+    for (size_t k = 0; k < errors.size() && k < shown; k++)
     {
-        std::cout << "Type: " << waste.type
-                  << ", Quantity: " << waste.quantity
-                  << ", Location: " << waste.location
-                  << ", Date: " << waste.date
-                  << ", Condition: " << waste.condition << "\n";
+        cout << "  line " << errors[k].line << ": " << errors[k].message << "\n";
+    }
+    if (errors.size() > shown)
+    {
+        cout << "  ... and " << errors.size() - shown << " more\n";
     }
 }
 
 
-// Function to validate integer input
+// ASCII lowercase copy of text, the case folding the city filters use
+string foldCase(string_view text)
+{
+    string folded(text);
+    transform(folded.begin(), folded.end(), folded.begin(), [](unsigned char c) { return static_cast<char>(tolower(c)); });
+    return folded;
+}
 
-void validateInput(int& input, const std::string& prompt)
- {
-    std::cout << prompt;
 
-    while (!(std::cin >> input))
+// Fields are views of text held by the AreaDatabase (its CSV file or text it keeps)
+class Area
+{
+public:
+    string_view name;
+    string_view address;
+    string_view city;
+
+    void display() const
     {
-        // Clear error flag
-        std::cin.clear();
-        // Ignore incorrect input
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << "Invalid input. Please enter a valid integer: ";
+        cout << left << setw(30) << name << setw(50) << address << setw(30) << city << endl;
     }
-}
+};
 
 
-// Function to validate string input
-void validateInput(std::string& input, const std::string& prompt)
+// Areas stored column by column, with the city dictionary-encoded, plus indexes kept up
+// to date on every change: a hash and a sorted index on name, and per city (exact and
+// case-folded) the ids of its areas. An area's id is its position and never changes: deleting leaves a gap that is
+// not reused until clear(), so anything keyed by id stays valid
+class AreaStore
 {
-    std::cout << prompt;
-    std::getline(std::cin, input);
+public:
+    using Id = uint32_t;
+    static constexpr Id NONE = ~Id(0);
 
-    while (input.empty())
+    // Walks the live areas in id (insertion) order
+    class const_iterator
     {
-        std::cout << "Invalid input. Please enter a valid string: ";
-        std::getline(std::cin, input);
+    public:
+        const_iterator(const AreaStore* store, Id id) : store(store), at(id) { skipDeleted(); }
+        Area operator*() const { return (*store)[at]; }
+        const_iterator& operator++()
+        {
+            ++at;
+            skipDeleted();
+            return *this;
+        }
+        bool operator!=(const const_iterator& other) const { return at != other.at; }
+        Id id() const { return at; }
+
+    private:
+        const AreaStore* store;
+        Id at;
+
+        void skipDeleted()
+        {
+            while (at < store->alive.size() && !store->alive[at])
+                ++at;
+        }
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, static_cast<Id>(alive.size())); }
+
+    size_t size() const { return live; }
+    void reserve(size_t count)
+    {
+        names.reserve(count);
+        addresses.reserve(count);
+        cityCodes.reserve(count);
+        alive.reserve(count);
+        sameNameNext.reserve(count);
+        populations.reserve(count);
+        nameIndex.reserve(count);
+    }
+    bool empty() const { return live == 0; }
+    // One more than the largest id handed out
+    size_t idLimit() const { return alive.size(); }
+    bool contains(Id id) const { return id < alive.size() && alive[id]; }
+
+    Area operator[](Id id) const { return {names[id], addresses[id], cityNames[cityCodes[id]]}; }
+    uint32_t cityCode(Id id) const { return cityCodes[id]; }
+
+    // The area's text must outlive the store
+    Id add(const Area& area)
+    {
+        Id id = static_cast<Id>(alive.size());
+        names.push_back(area.name);
+        addresses.push_back(area.address);
+        cityCodes.push_back(encodeCity(area.city));
+        alive.push_back(1);
+        sameNameNext.push_back(NONE);
+        populations.push_back(NO_POPULATION);
+        live++;
+        index(id);
+        return id;
+    }
+
+    void update(Id id, const Area& area)
+    {
+        unindex(id);
+        names[id] = area.name;
+        addresses[id] = area.address;
+        cityCodes[id] = encodeCity(area.city);
+        index(id);
+    }
+
+    void erase(Id id)
+    {
+        unindex(id);
+        alive[id] = 0;
+        populations[id] = NO_POPULATION;
+        live--;
+    }
+
+    void clear()
+    {
+        names.clear();
+        addresses.clear();
+        cityCodes.clear();
+        alive.clear();
+        sameNameNext.clear();
+        populations.clear();
+        live = 0;
+        cityNames.clear();
+        cityIndex.clear();
+        cityMembers.clear();
+        cityFolded.clear();
+        foldedIndex.clear();
+        foldedNames.clear();
+        foldedMembers.clear();
+        nameIndex.clear();
+        nameOrder.clear();
+        nameOrderSorted = true;
+        keyIndex.clear();
+        keyIndexBuilt = false;
+    }
+
+    // Ids of the areas called name, oldest first; empty if none
+    vector<Id> named(string_view name) const
+    {
+        vector<Id> ids;
+        auto it = nameIndex.find(name);
+        for (Id id = it == nameIndex.end() ? NONE : it->second; id != NONE; id = sameNameNext[id])
+        {
+            ids.push_back(id);
+        }
+        return ids;
     }
-}
 
-// Function to handle case-sensitive and partial matching of waste types
-#include <iostream>
-#include <vector>
-#include <map>
-#include <algorithm>
+    // The key population data is entered under: the name without its spaces
+    static string populationKey(string_view name)
+    {
+        string key;
+        key.reserve(name.size());
+        for (char c : name)
+        {
+            if (c != ' ')
+                key += c;
+        }
+        return key;
+    }
 
-using namespace std;
+    // Ids of the areas whose population key is key, in id order; empty if none
+    const vector<Id>& keyed(const string& key) const
+    {
+        static const vector<Id> none;
+        if (!keyIndexBuilt)
+        {
+            for (Id id = 0; id < alive.size(); id++)
+            {
+                if (alive[id])
+                    keyIndex[populationKey(names[id])].push_back(id);
+            }
+            keyIndexBuilt = true;
+        }
+        auto it = keyIndex.find(key);
+        return it == keyIndex.end() ? none : it->second;
+    }
 
-void selectFactoryForWasteType()
+    // Population by id, NO_POPULATION (NaN) where there is none. Deleted ids hold
+    // NO_POPULATION too, so a report can run straight down the column
+    static constexpr double NO_POPULATION = numeric_limits<double>::quiet_NaN();
+    static bool hasPopulation(double population) { return !isnan(population); }
+    double population(Id id) const { return populations[id]; }
+    const vector<double>& populationColumn() const { return populations; }
+    void setPopulation(Id id, double population) { populations[id] = population; }
+    void clearPopulation() { fill(populations.begin(), populations.end(), NO_POPULATION); }
+
+    // Ids of every live area in name order (ties by id)
+    const vector<Id>& byName() const
+    {
+        sortNameOrder();
+        return nameOrder;
+    }
+
+    // The city dictionary: code -> name, and the ids of each city's areas in id order
+    size_t cityCount() const { return cityNames.size(); }
+    string_view cityName(uint32_t code) const { return cityNames[code]; }
+    const vector<Id>& inCity(uint32_t code) const { return cityMembers[code]; }
+
+    // Ids of the areas whose city folds to foldedCity (see foldCase), in id order, so
+    // "Belgaum" and "BELGAUM" share one list; empty if none
+    const vector<Id>& inFoldedCity(string_view foldedCity) const
+    {
+        static const vector<Id> none;
+        auto it = foldedIndex.find(foldedCity);
+        return it == foldedIndex.end() ? none : foldedMembers[it->second];
+    }
+
+private:
+    vector<string_view> names;
+    vector<string_view> addresses;
+    vector<uint32_t> cityCodes;
+    vector<char> alive;
+    size_t live = 0;
+
+    vector<string_view> cityNames;
+    unordered_map<string_view, uint32_t> cityIndex;
+    vector<vector<Id>> cityMembers;
+    // City code -> folded city code; each spelling is folded once, when first seen
+    vector<uint32_t> cityFolded;
+    deque<string> foldedNames;
+    unordered_map<string_view, uint32_t> foldedIndex;
+    vector<vector<Id>> foldedMembers;
+    // Name -> its oldest area; sameNameNext chains the later ones in id order
+    unordered_map<string_view, Id> nameIndex;
+    vector<Id> sameNameNext;
+    vector<double> populations;
+    // Population key -> ids in id order. Only population data looks areas up this way, so
+    // it is built on first use and kept up to date from then on
+    mutable unordered_map<string, vector<Id>> keyIndex;
+    mutable bool keyIndexBuilt = false;
+    // Sorted by (name, id). An area added out of order (a file that is not sorted by name)
+    // is appended and the whole list sorted once when it is next needed, so loading stays
+    // linear and a single edit is a binary search and a move
+    mutable vector<Id> nameOrder;
+    mutable bool nameOrderSorted = true;
+
+    bool nameBefore(Id a, Id b) const
+    {
+        return names[a] < names[b] || (names[a] == names[b] && a < b);
+    }
+
+    void sortNameOrder() const
+    {
+        if (!nameOrderSorted)
+        {
+            sort(nameOrder.begin(), nameOrder.end(), [this](Id a, Id b) { return nameBefore(a, b); });
+            nameOrderSorted = true;
+        }
+    }
+
+    uint32_t encodeCity(string_view city)
+    {
+        auto [it, added] = cityIndex.emplace(city, static_cast<uint32_t>(cityNames.size()));
+        if (added)
+        {
+            cityNames.push_back(city);
+            cityMembers.emplace_back();
+
+            string folded = foldCase(city);
+            auto found = foldedIndex.find(folded);
+            if (found == foldedIndex.end())
+            {
+                foldedNames.push_back(move(folded));
+                found = foldedIndex.emplace(foldedNames.back(), static_cast<uint32_t>(foldedMembers.size())).first;
+                foldedMembers.emplace_back();
+            }
+            cityFolded.push_back(found->second);
+        }
+        return it->second;
+    }
+
+    // Ids only grow, so adding to a list in id order is normally an append
+    static void insertSorted(vector<Id>& ids, Id id)
+    {
+        ids.insert(upper_bound(ids.begin(), ids.end(), id), id);
+    }
+
+    static void eraseSorted(vector<Id>& ids, Id id)
+    {
+        auto it = lower_bound(ids.begin(), ids.end(), id);
+        if (it != ids.end() && *it == id)
+            ids.erase(it);
+    }
+
+    void index(Id id)
+    {
+        // Link into the same-name chain, which is kept in id order
+        sameNameNext[id] = NONE;
+        auto [named, added] = nameIndex.emplace(names[id], id);
+        if (!added)
+        {
+            Id* link = &named->second;
+            while (*link != NONE && *link < id)
+                link = &sameNameNext[*link];
+            sameNameNext[id] = *link;
+            *link = id;
+        }
+
+        if (nameOrderSorted && !nameOrder.empty() && nameBefore(id, nameOrder.back()))
+        {
+            if (alive.size() == id + 1)
+            {
+                // A new area out of order: leave the sort for later
+                nameOrderSorted = false;
+                nameOrder.push_back(id);
+            }
+            else
+            {
+                nameOrder.insert(upper_bound(nameOrder.begin(), nameOrder.end(), id,
+                                             [this](Id a, Id b) { return nameBefore(a, b); }), id);
+            }
+        }
+        else
+        {
+            nameOrder.push_back(id);
+        }
+        insertSorted(cityMembers[cityCodes[id]], id);
+        insertSorted(foldedMembers[cityFolded[cityCodes[id]]], id);
+        if (keyIndexBuilt)
+            insertSorted(keyIndex[populationKey(names[id])], id);
+    }
+
+    void unindex(Id id)
+    {
+        auto named = nameIndex.find(names[id]);
+        Id* link = &named->second;
+        while (*link != id)
+            link = &sameNameNext[*link];
+        *link = sameNameNext[id];
+        if (named->second == NONE)
+            nameIndex.erase(named);
+
+        sortNameOrder();
+        auto at = lower_bound(nameOrder.begin(), nameOrder.end(), id, [this](Id a, Id b) { return nameBefore(a, b); });
+        nameOrder.erase(at);
+        eraseSorted(cityMembers[cityCodes[id]], id);
+        eraseSorted(foldedMembers[cityFolded[cityCodes[id]]], id);
+        if (keyIndexBuilt)
+        {
+            auto keyed = keyIndex.find(populationKey(names[id]));
+            eraseSorted(keyed->second, id);
+            if (keyed->second.empty())
+                keyIndex.erase(keyed);
+        }
+    }
+};
+
+// Statistics over a numeric column such as AreaStore::populationColumn. NaN entries (no
+// data) are left out of every result. The kernels take two values per SSE2 instruction
+// where available, and do no formatting, so the reports print from their results
+
+// count, sum, min and max of the column's values; minAt and maxAt are the first
+// positions holding min and max. All zero when there are no values
+struct ColumnStats
 {
-    // List of valid waste types
-    vector<string> validWasteTypes = {"plastic", "E-waste", "organic", "paper", "glass", "metal"};
+    size_t count = 0;
+    double sum = 0;
+    double min = 0;
+    double max = 0;
+    size_t minAt = 0;
+    size_t maxAt = 0;
+};
 
-    string wasteType;
-    cout << "Enter the type of waste to send to the factory: ";
-    cin.ignore();  // Ignore extra newline characters
-    getline(cin, wasteType);
+ColumnStats summarizeColumn(const vector<double>& values)
+{
+    const double* v = values.data();
+    size_t n = values.size();
+    size_t i = 0;
+    double count = 0;
+    double sum = 0;
+    double lo = numeric_limits<double>::infinity();
+    double hi = -numeric_limits<double>::infinity();
+
+#ifdef AREA_STATS_SSE2
+    // Two sets of accumulators, four values a step. minpd and maxpd return their second
+    // operand when the first is NaN, so a missing value leaves lo and hi as they were
+    const __m128d one = _mm_set1_pd(1.0);
+    __m128d counts[2] = {_mm_setzero_pd(), _mm_setzero_pd()};
+    __m128d sums[2] = {_mm_setzero_pd(), _mm_setzero_pd()};
+    __m128d los[2] = {_mm_set1_pd(lo), _mm_set1_pd(lo)};
+    __m128d his[2] = {_mm_set1_pd(hi), _mm_set1_pd(hi)};
+    for (; i + 4 <= n; i += 4)
+    {
+        for (int k = 0; k < 2; k++)
+        {
+            __m128d x = _mm_loadu_pd(v + i + 2 * k);
+            __m128d present = _mm_cmpord_pd(x, x);
+            counts[k] = _mm_add_pd(counts[k], _mm_and_pd(present, one));
+            sums[k] = _mm_add_pd(sums[k], _mm_and_pd(present, x));
+            los[k] = _mm_min_pd(x, los[k]);
+            his[k] = _mm_max_pd(x, his[k]);
+        }
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(counts[0], counts[1]));
+    count = lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, _mm_add_pd(sums[0], sums[1]));
+    sum = lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, _mm_min_pd(los[0], los[1]));
+    lo = (std::min)(lanes[0], lanes[1]);
+    _mm_storeu_pd(lanes, _mm_max_pd(his[0], his[1]));
+    hi = (std::max)(lanes[0], lanes[1]);
+#endif
+    for (; i < n; i++)
+    {
+        if (!isnan(v[i]))
+        {
+            count++;
+            sum += v[i];
+            lo = (std::min)(lo, v[i]);
+            hi = (std::max)(hi, v[i]);
+        }
+    }
 
-    // Convert wasteType to lowercase for partial matching (if needed)
-    string lowerWasteType = wasteType;
-    transform(lowerWasteType.begin(), lowerWasteType.end(), lowerWasteType.begin(), ::tolower);
+    ColumnStats stats;
+    if (count == 0)
+    {
+        return stats;
+    }
+    stats.count = static_cast<size_t>(count);
+    stats.sum = sum;
+    stats.min = lo;
+    stats.max = hi;
+    // The first occurrences, which is what a loop keeping the first strict winner reports
+    stats.minAt = find(values.begin(), values.end(), lo) - values.begin();
+    stats.maxAt = find(values.begin(), values.end(), hi) - values.begin();
+    return stats;
+}
 
-    // Find relevant waste types based on partial match
-    vector<string> matchingTypes;
-    for (const auto& validType : validWasteTypes)
+// out[i] = values[i] * factor, NaN staying NaN
+void scaleColumn(const vector<double>& values, double factor, vector<double>& out)
+{
+    out.resize(values.size());
+    const double* v = values.data();
+    double* o = out.data();
+    size_t n = values.size();
+    size_t i = 0;
+#ifdef AREA_STATS_SSE2
+    const __m128d f = _mm_set1_pd(factor);
+    for (; i + 2 <= n; i += 2)
     {
-        // Check if the input wasteType partially matches any of the valid waste types
-        if (validType.find(lowerWasteType) != string::npos)
+        _mm_storeu_pd(o + i, _mm_mul_pd(_mm_loadu_pd(v + i), f));
+    }
+#endif
+    for (; i < n; i++)
+    {
+        o[i] = v[i] * factor;
+    }
+}
+
+// Bar lengths for a '*' chart scaled so that max gets width: values[i] / max * width,
+// truncated. Missing and negative values, and every value when max is not positive, get 0
+void barLengths(const vector<double>& values, double max, int width, vector<int>& out)
+{
+    out.assign(values.size(), 0);
+    if (!(max > 0))
+    {
+        return;
+    }
+    const double* v = values.data();
+    int* o = out.data();
+    size_t n = values.size();
+    size_t i = 0;
+#ifdef AREA_STATS_SSE2
+    // maxpd against zero turns NaN into zero as well (it returns the second operand)
+    const __m128d top = _mm_set1_pd(max);
+    const __m128d scale = _mm_set1_pd(width);
+    const __m128d zero = _mm_setzero_pd();
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i low = _mm_cvttpd_epi32(_mm_mul_pd(_mm_div_pd(_mm_max_pd(_mm_loadu_pd(v + i), zero), top), scale));
+        __m128i high = _mm_cvttpd_epi32(_mm_mul_pd(_mm_div_pd(_mm_max_pd(_mm_loadu_pd(v + i + 2), zero), top), scale));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(o + i), _mm_unpacklo_epi64(low, high));
+    }
+#endif
+    for (; i < n; i++)
+    {
+        if (v[i] > 0)
+        {
+            o[i] = static_cast<int>(v[i] / max * width);
+        }
+    }
+}
+
+class AreaDatabase
+{
+private:
+    AreaStore areas;
+    // Population as entered, by population key; areas.population holds the same
+    // figures resolved to area ids, which is what the reports read
+    map<string, double> populationData;
+    // The last area file loaded, which the areas read from it point into
+    CsvFile areaFile;
+    // Text of areas added or edited since, likewise pointed into
+    deque<string> keptText;
+
+    string_view keepText(string_view text)
+    {
+        keptText.emplace_back(text);
+        return keptText.back();
+    }
+
+    void attachPopulation(const string& key);
+    void attachPopulation(AreaStore::Id id);
+    void attachPopulation();
+
+public:
+    void displayWelcomeMessage() const;
+    void loadFromFile();
+    void displayAllAreas() const;
+    void updateAreaData();
+    void deleteAreaByName();
+    void addNewArea();
+    void saveToFile() const;
+    void enterPopulationData();
+    void calculateWasteGeneration() const;
+    void sortAreasByName();
+    void filterAreasByCity();
+    void exportToCSV() const;
+    void calculateAveragePopulation() const;
+    void printPopulationStats() const;
+    void calculateAverageWasteGeneration() const; // New function declaration
+
+    // Non-interactive operations (used by the batch mode)
+    int loadAreasFromFile(const string& filename);
+    int readAreaFile(const string& filename, vector<CsvError>& errors);
+    void addArea(const Area& area);
+    void setPopulation(const string& areaName, double population);
+    bool printWasteGenerationTable(double wastePerCapita) const;
+    double totalWasteGeneration(double wastePerCapita) const;
+    size_t areaCount() const { return areas.size(); }
+};
+
+
+void AreaDatabase::displayWelcomeMessage() const {
+    for (int i = 0; i < 80; i++) cout << "*";
+    cout << "\n\n\t\t\t\tAREA_INFO\n\n\n";
+    for (int i = 0; i < 80; i++) cout << "*";
+    cout << "\n\n";
+}
+// Reads "name,address,city" records into the area list, replacing the current data, and
+// reports the bad ones together. Returns the number of records (good and bad), or -1 if
+// the file cannot be opened
+int AreaDatabase::loadAreasFromFile(const string& filename)
+{
+    vector<CsvError> errors;
+    int records = readAreaFile(filename, errors);
+    if (records >= 0)
+    {
+        printCsvErrors(filename, areas.size(), errors);
+    }
+    return records;
+}
+
+// loadAreasFromFile without the report. The areas point into the mapped file, which stays
+// open until the next load, so nothing is copied
+int AreaDatabase::readAreaFile(const string& filename, vector<CsvError>& errors)
+{
+    CsvFile file;
+    if (!file.open(filename))
+    {
+        return -1;
+    }
+
+    areas.clear();
+    areas.reserve(file.lineBreaks() + 1);
+    keptText.clear();
+    errors.clear();
+    file.forEachRecord([this, &errors](size_t line, const vector<string_view>& fields) {
+        if (fields.size() == 3)
+        {
+            areas.add({fields[0], fields[1], fields[2]});
+        }
+        else
+        {
+            errors.push_back({line, "expected 3 fields (name,address,city), found " + to_string(fields.size())});
+        }
+    }, errors);
+    areaFile = move(file);
+    if (!populationData.empty())
+    {
+        attachPopulation();
+    }
+    return static_cast<int>(areas.size() + errors.size());
+}
+
+// The area's text is copied, so it may point anywhere
+void AreaDatabase::addArea(const Area& area)
+{
+    attachPopulation(areas.add({keepText(area.name), keepText(area.address), keepText(area.city)}));
+}
+
+// Population keys are stored without spaces, matching enterPopulationData
+void AreaDatabase::setPopulation(const string& areaName, double population)
+{
+    string key = AreaStore::populationKey(areaName);
+    populationData[key] = population;
+    attachPopulation(key);
+}
+
+// Copies key's population (or its absence) to every area it names
+void AreaDatabase::attachPopulation(const string& key)
+{
+    auto it = populationData.find(key);
+    double population = it == populationData.end() ? AreaStore::NO_POPULATION : it->second;
+    for (AreaStore::Id id : areas.keyed(key))
+    {
+        areas.setPopulation(id, population);
+    }
+}
+
+// Looks up the population of an area that was just added or renamed
+void AreaDatabase::attachPopulation(AreaStore::Id id)
+{
+    auto it = populationData.find(AreaStore::populationKey(areas[id].name));
+    areas.setPopulation(id, it == populationData.end() ? AreaStore::NO_POPULATION : it->second);
+}
+
+// Resolves all of the population data again, after the areas or the data were replaced
+void AreaDatabase::attachPopulation()
+{
+    areas.clearPopulation();
+    for (const auto& entry : populationData)
+    {
+        attachPopulation(entry.first);
+    }
+}
+
+void AreaDatabase::loadFromFile()
+{
+    string filename;
+    cout << "Enter the filename to load area data from: ";
+    cin >> filename;
+
+    int lineCount = loadAreasFromFile(filename);
+    if (lineCount < 0)
+    {
+        cout << "Error: File \"" << filename << "\" not found.\n";
+        return;
+    }
+
+    int errorsCount = lineCount - static_cast<int>(areas.size());
+
+    if (errorsCount == 0)
+    {
+        cout << "Area data successfully loaded from file \"" << filename << "\".\n";
+    }
+    else
+    {
+        cout << errorsCount << " errors occurred during file loading.\n";
+        cout << "Some areas may not have been added correctly.\n";
+    }
+
+    // Display the number of lines loaded and errors encountered
+    cout << lineCount << " total lines processed.\n";
+    if (errorsCount > 0)
+    {
+        cout << errorsCount << " lines could not be parsed correctly.\n";
+    }
+    else
+    {
+        cout << "All lines were successfully parsed.\n";
+    }
+
+    // Optionally, print out the loaded areas if no errors
+    if (errorsCount == 0)
+    {
+        cout << "Displaying all areas loaded from the file:\n";
+        displayAllAreas();
+    }
+    else
+    {
+        cout << "Displaying only the correctly loaded areas:\n";
+        for (const auto& area : areas)
+        {
+            area.display();
+        }
+    }
+
+    // Ask the user if they want to reload the data or proceed
+    char choice;
+    cout << "Would you like to reload the data from another file (y/n)? ";
+    cin >> choice;
+    if (choice == 'y' || choice == 'Y') {
+        loadFromFile();
+    }
+     else
+    {
+        cout << "Proceeding with the loaded data.\n";
+    }
+
+    // Example of additional parsing logic for handling extra data fields (if applicable)
+    char extraChoice;
+    cout << "Would you like to load additional data from another file (such as population data)? (y/n): ";
+    cin >> extraChoice;
+    if (extraChoice == 'y' || extraChoice == 'Y') {
+        string additionalFile;
+        cout << "Enter the filename for the additional data (e.g., population data): ";
+        cin >> additionalFile;
+
+        ifstream additionalFileStream(additionalFile);
+        if (!additionalFileStream) {
+            cout << "Error: File \"" << additionalFile << "\" not found.\n";
+            return;
+        }
+
+        // This could be logic to process additional data
+        string areaName;
+        double population;
+        while (getline(additionalFileStream, areaName, ',') && additionalFileStream >> population) {
+            // Example additional processing logic for population data
+            // Assuming a map populationData exists, we can add it
+            areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end()); // Remove spaces
+            populationData[areaName] = population;
+            attachPopulation(areaName);
+        }
+
+        additionalFileStream.close();
+        cout << "Additional data loaded successfully from \"" << additionalFile << "\".\n";
+    }
+
+    // Adding logic to verify the consistency of data
+    if (areas.size() != populationData.size()) {
+        cout << "Warning: There is a mismatch between the number of areas and population data.\n";
+    } else {
+        cout << "Area and population data are consistent.\n";
+    }
+
+    // Provide options for validating data integrity
+    char validationChoice;
+    cout << "Would you like to validate the loaded data for correctness (y/n)? ";
+    cin >> validationChoice;
+    if (validationChoice == 'y' || validationChoice == 'Y')
+    {
+        cout << "Validating loaded data...\n";
+        int validCount = 0;
+        for (const auto& area : areas)
+       {
+            // Example validation: Check if the area has a valid city and address
+            if (!area.name.empty() && !area.address.empty() && !area.city.empty()) {
+                validCount++;
+            } else {
+                cout << "Invalid data detected for area: " << area.name << endl;
+            }
+        }
+
+        cout << validCount << " valid areas found out of " << areas.size() << ".\n";
+    }
+
+    // Advanced option to handle file format errors more robustly
+    cout << "Would you like to attempt an auto-correction for file format issues (y/n)? ";
+    cin >> validationChoice;
+    if (validationChoice == 'y' || validationChoice == 'Y') {
+        cout << "Attempting to auto-correct file format issues...\n";
+        // Advanced auto-correction logic can be added here based on the file format (e.g., handling missing commas, fixing newlines, etc.)
+    }
+
+    // After all data is loaded, provide options to save the data back to a file if needed
+    char saveChoice;
+    cout << "Would you like to save the loaded data to a new file (y/n)? ";
+    cin >> saveChoice;
+    if (saveChoice == 'y' || saveChoice == 'Y') {
+        string newFileName;
+        cout << "Enter the filename to save the data: ";
+        cin >> newFileName;
+        ofstream saveFile(newFileName);
+
+        if (!saveFile) {
+            cout << "Error: Could not open file \"" << newFileName << "\" for saving.\n";
+            return;
+        }
+
+        for (const auto& area : areas) {
+            saveFile << area.name << "," << area.address << "," << area.city << endl;
+        }
+
+        saveFile.close();
+        cout << "Data saved successfully to \"" << newFileName << "\".\n";
+    }
+
+    // Final confirmation and summary of loaded data
+    cout << "\nFinal Summary of Loaded Data:\n";
+    cout << "Total Areas Loaded: " << areas.size() << endl;
+    cout << "Total Population Data Entries: " << populationData.size() << endl;
+    cout << "Any errors or inconsistencies were addressed.\n";
+    cout << "Proceeding with program...\n";
+}
+void AreaDatabase::displayAllAreas() const {
+    if (areas.empty())
+    {
+        cout << "No area data to display. Please load data first.\n";
+        return;
+    }
+
+    // Sorting option for displaying areas
+    char sortChoice;
+    cout << "Would you like to sort the areas by name (y/n)? ";
+    cin >> sortChoice;
+
+    // The name index already holds the sorted order
+    vector<Area> sortedAreas;
+    sortedAreas.reserve(areas.size());
+
+    if (sortChoice == 'y' || sortChoice == 'Y')
+    {
+        for (AreaStore::Id id : areas.byName())
+        {
+            sortedAreas.push_back(areas[id]);
+        }
+        cout << "Areas sorted by name.\n";
+    }
+
+    else
+    {
+        for (const auto& area : areas)
+        {
+            sortedAreas.push_back(area);
+        }
+        cout << "Displaying areas without sorting.\n";
+    }
+
+    // Filter option to only show areas in a specific city
+    char filterChoice;
+    cout << "Would you like to filter the areas by city (y/n)? ";
+    cin >> filterChoice;
+
+    string filterCity;
+    if (filterChoice == 'y' || filterChoice == 'Y') {
+        cout << "Enter the city name to filter areas: ";
+        cin.ignore();  // To clear the newline left by previous input
+        getline(cin, filterCity);
+    }
+
+    // Display the headers
+    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+    cout << string(110, '-') << endl;
+
+    // Loop through the areas and display them
+    bool displayed = false;
+    for (const auto& area : sortedAreas) {
+        if (filterChoice == 'y' || filterChoice == 'Y') {
+            // Only display areas in the specified city
+            if (area.city == filterCity) {
+                area.display();
+                displayed = true;
+            }
+        }
+
+        else
+        {
+            // Display all areas if no filter is applied
+            area.display();
+            displayed = true;
+        }
+    }
+
+    if (!displayed)
+    {
+        cout << "No areas found matching the filter criteria.\n";
+    }
+
+    // Option to display details for a specific area
+    char detailChoice;
+    cout << "Would you like to view more details about a specific area (y/n)? ";
+    cin >> detailChoice;
+
+    if (detailChoice == 'y' || detailChoice == 'Y')
+    {
+        string areaName;
+        cout << "Enter the area name to view details: ";
+        cin.ignore();  // Clear the newline
+        getline(cin, areaName);
+
+        bool found = false;
+        for (const auto& area : sortedAreas)
+        {
+            if (area.name == areaName)
+            {
+                found = true;
+                cout << "\nDetails for Area: " << area.name << endl;
+                cout << "Address: " << area.address << endl;
+                cout << "City: " << area.city << endl;
+                // You can add more detailed information here if needed, e.g., population, waste generation, etc.
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            cout << "Area \"" << areaName << "\" not found.\n";
+        }
+    }
+
+    // Ask the user if they want to display areas again
+    char repeatChoice;
+    cout << "Would you like to display the areas again (y/n)? ";
+    cin >> repeatChoice;
+
+    if (repeatChoice == 'y' || repeatChoice == 'Y') {
+        displayAllAreas(); // Recursively call the function again to display the areas
+    } else {
+        cout << "Returning to main menu.\n";
+    }
+}
+void AreaDatabase::updateAreaData()
+{
+    if (areas.empty())
+    {
+        cout << "No area data available to update. Please load data first.\n";
+        return;
+    }
+
+    string searchName;
+    cout << "\nEnter the area name to update: ";
+    cin.ignore();
+    getline(cin, searchName);
+
+    // Look the name up in the name index
+    const vector<AreaStore::Id>& matches = areas.named(searchName);
+
+    if (matches.empty())
+    {
+        cout << "Area \"" << searchName << "\" not found.\n";
+        return;
+    }
+
+    // Display the current data
+    AreaStore::Id id = matches.front();
+    Area areaToUpdate = areas[id];
+    cout << "\nCurrent data for \"" << searchName << "\":\n";
+    cout << "Name: " << areaToUpdate.name << "\n";
+    cout << "Address: " << areaToUpdate.address << "\n";
+    cout << "City: " << areaToUpdate.city << "\n";
+
+    // Confirm update
+    char confirmUpdate;
+    cout << "\nDo you want to update this area? (y/n): ";
+    cin >> confirmUpdate;
+
+    if (confirmUpdate != 'y' && confirmUpdate != 'Y')
+    {
+        cout << "Update cancelled.\n";
+        return;
+    }
+
+    // Backup current data (the text stays alive, so the views are enough)
+    string_view oldName = areaToUpdate.name;
+    string_view oldAddress = areaToUpdate.address;
+    string_view oldCity = areaToUpdate.city;
+
+    cin.ignore();
+    cout << "Enter new area name (leave blank to keep unchanged): ";
+    string newName;
+    getline(cin, newName);
+    if (!newName.empty())
+    {
+        areaToUpdate.name = keepText(newName);
+    }
+
+    cout << "Enter new address (leave blank to keep unchanged): ";
+    string newAddress;
+    getline(cin, newAddress);
+    if (!newAddress.empty())
+    {
+        areaToUpdate.address = keepText(newAddress);
+    }
+
+    cout << "Enter new city (leave blank to keep unchanged): ";
+    string newCity;
+    getline(cin, newCity);
+    if (!newCity.empty())
+    {
+        areaToUpdate.city = keepText(newCity);
+    }
+
+    areas.update(id, areaToUpdate);
+    attachPopulation(id);
+    cout << "Area data updated successfully.\n";
+
+    // Log the changes
+    cout << "\nUpdate Summary:\n";
+    cout << "Previous Name: " << oldName << ", New Name: " << areaToUpdate.name << "\n";
+    cout << "Previous Address: " << oldAddress << ", New Address: " << areaToUpdate.address << "\n";
+    cout << "Previous City: " << oldCity << ", New City: " << areaToUpdate.city << "\n";
+
+    // Undo option
+    char undoChoice;
+    cout << "\nWould you like to undo the update? (y/n): ";
+    cin >> undoChoice;
+
+    if (undoChoice == 'y' || undoChoice == 'Y')
+    {
+        areaToUpdate.name = oldName;
+        areaToUpdate.address = oldAddress;
+        areaToUpdate.city = oldCity;
+        areas.update(id, areaToUpdate);
+        attachPopulation(id);
+
+        cout << "Update undone. Data restored to:\n";
+        cout << "Name: " << areaToUpdate.name << "\n";
+        cout << "Address: " << areaToUpdate.address << "\n";
+        cout << "City: " << areaToUpdate.city << "\n";
+    }
+
+    // Ask to update another area
+    char continueChoice;
+    cout << "\nWould you like to update another area? (y/n): ";
+    cin >> continueChoice;
+
+    if (continueChoice == 'y' || continueChoice == 'Y')
+    {
+        updateAreaData(); // Recursive call
+    }
+
+
+    else
+    {
+        cout << "Returning to main menu...\n";
+    }
+
+    // Additional logs or user prompts can be added to expand the code further
+    cout << "End of update process.\n";
+}
+
+void AreaDatabase::deleteAreaByName()
+ {
+    // Step 1: Check if there is any data to delete
+    if (areas.empty())
+    {
+        cout << "No area data available to delete. Please load data first.\n";
+        return;
+    }
+
+    // Step 2: Get the name of the area to delete
+    string searchName;
+    cout << "\nEnter the area name to delete: ";
+    cin.ignore(); // Clear input buffer
+    getline(cin, searchName);
+
+    // Step 3: Look up the matching areas in the name index
+    vector<AreaStore::Id> matchingIndexes = areas.named(searchName);
+
+    // Step 4: Check if any areas were found
+    if (matchingIndexes.empty())
+    {
+        cout << "No areas found with the name \"" << searchName << "\".\n";
+        return;
+    }
+
+    // Step 5: Display all matching areas
+    cout << "\nMatching areas found:\n";
+
+    cout << left << setw(10) << "Index" << setw(30) << "Name" << setw(50) << "Address" << setw(30) << "City" << "\n";
+
+    cout << string(110, '-') << "\n";
+
+    for (size_t i = 0; i < matchingIndexes.size(); i++)
+    {
+        AreaStore::Id index = matchingIndexes[i];
+        const Area area = areas[index];
+        cout << left << setw(10) << i + 1 << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << "\n";
+    }
+
+    // Step 6: Select the specific area to delete
+    int deleteIndex = 0;
+    if (matchingIndexes.size() > 1)
+    {
+        cout << "\nMultiple matching areas found. Enter the index of the area you want to delete: ";
+        cin >> deleteIndex;
+
+        if (deleteIndex < 1 || deleteIndex > (int)matchingIndexes.size())
+        {
+            cout << "Invalid selection. Deletion process cancelled.\n";
+            return;
+        }
+        deleteIndex = matchingIndexes[deleteIndex - 1];
+    }
+
+    else
+    {
+        deleteIndex = matchingIndexes[0];
+    }
+
+    // Step 7: Confirm the deletion
+    const Area areaToDelete = areas[deleteIndex];
+    cout << "\nYou selected the following area to delete:\n";
+
+    cout << "Name: " << areaToDelete.name << "\n";
+
+    cout << "Address: " << areaToDelete.address << "\n";
+
+    cout << "City: " << areaToDelete.city << "\n";
+
+    char confirmDelete;
+    cout << "\nAre you sure you want to delete this area? (y/n): ";
+
+    cin >> confirmDelete;
+
+    if (confirmDelete != 'y' && confirmDelete != 'Y')
+    {
+        cout << "Deletion process cancelled.\n";
+        return;
+    }
+
+    // Step 8: Backup the data for undo
+    Area backupArea = areaToDelete;
+
+    // Step 9: Delete the area
+    areas.erase(deleteIndex);
+    cout << "\nArea \"" << areaToDelete.name << "\" deleted successfully.\n";
+
+    // Step 10: Offer undo option
+    char undoChoice;
+    cout << "\nWould you like to undo the deletion? (y/n): ";
+    cin >> undoChoice;
+
+    if (undoChoice == 'y' || undoChoice == 'Y')
+    {
+        attachPopulation(areas.add(backupArea));
+        cout << "\nDeletion undone. Area data restored.\n";
+    }
+
+
+    else
+    {
+        cout << "\nDeletion confirmed.\n";
+    }
+
+    // Step 11: Ask if the user wants to delete another area
+    char continueChoice;
+    cout << "\nWould you like to delete another area? (y/n): ";
+    cin >> continueChoice;
+
+    if (continueChoice == 'y' || continueChoice == 'Y')
+    {
+        deleteAreaByName(); // Recursive call for another deletion
+    }
+
+
+    else
+    {
+        cout << "\nReturning to the main menu...\n";
+    }
+
+    // Step 12: Additional log (Optional, extend as needed)
+    cout << "Deletion process completed. Thank you.\n";
+
+    // Note: The code can be further expanded by:
+    // 1. Logging each action (e.g., log deleted areas to a file).
+    // 2. Adding additional error checks and validations.
+    // 3. Enhancing the user interface for more detailed prompts.
+}
+
+
+void AreaDatabase::addNewArea()
+{
+    // Read into strings first; addArea keeps a copy of the text
+    string name, address, city;
+    string confirmation;
+    bool isDuplicate = false;
+
+    cout << "=== Add New Area ===\n";
+
+    // Step 1: Input Area Name
+    do
+    {
+        cout << "Enter area name: ";
+        cin.ignore();
+        getline(cin, name);
+
+        // Validate non-empty input
+        if (name.empty())
+        {
+            cout << "Error: Area name cannot be empty. Please try again.\n";
+            continue;
+        }
+
+        // Check for duplicate names
+        isDuplicate = !areas.named(name).empty();
+        if (isDuplicate)
+        {
+            cout << "Error: An area with the name \"" << name << "\" already exists. Please enter a unique name.\n";
+        }
+    } while (name.empty() || isDuplicate);
+
+    // Step 2: Input Address
+    do {
+        cout << "Enter address: ";
+        getline(cin, address);
+
+        // Validate non-empty input
+        if (address.empty()) {
+            cout << "Error: Address cannot be empty. Please try again.\n";
+        }
+    } while (address.empty());
+
+    // Step 3: Input City
+    do {
+        cout << "Enter city: ";
+        getline(cin, city);
+
+        // Validate non-empty input
+        if (city.empty()) {
+            cout << "Error: City cannot be empty. Please try again.\n";
+        }
+    } while (city.empty());
+
+    // Step 4: Confirm the Input
+    cout << "\nPlease review the entered details:\n";
+    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+    cout << left << setw(30) << name << setw(50) << address << setw(30) << city << endl;
+
+    do {
+        cout << "Is the information correct? (y/n): ";
+        cin >> confirmation;
+
+        if (confirmation == "n" || confirmation == "N")
+        {
+            cout << "Operation cancelled. Returning to menu.\n";
+            return;
+        }
+
+        else if (confirmation != "y" && confirmation != "Y")
+        {
+            cout << "Invalid input. Please enter 'y' or 'n'.\n";
+        }
+    } while (confirmation != "y" && confirmation != "Y");
+
+    // Step 5: Add to the Area List
+    addArea({name, address, city});
+    cout << "\nArea data added successfully.\n";
+
+    // Step 6: Log the New Area Addition
+    cout << "Logging the new area addition...\n";
+    // Example log statement - Replace with actual file or database logging
+    cout << "Log: New area \"" << name << "\" in \"" << city << "\" added.\n";
+
+    // Step 7: Offer to Add Another Area
+    char addAnother;
+    cout << "\nWould you like to add another area? (y/n): ";
+    cin >> addAnother;
+
+    if (addAnother == 'y' || addAnother == 'Y')
+    {
+        addNewArea();  // Recursive call to add another area
+    }
+
+    else
+    {
+        cout << "Returning to the main menu...\n";
+    }
+}
+
+    void AreaDatabase::saveToFile() const {
+    if (areas.empty())
+    {
+        cout << "No area data to save. Please add data before saving.\n";
+        return;
+    }
+
+    string filename;
+    string confirmation;
+    ofstream file;
+
+    // Step 1: Input Filename
+    do {
+        cout << "Enter the filename to save area data to: ";
+        cin >> filename;
+
+        // Confirm overwriting existing file
+        ifstream checkFile(filename);
+        if (checkFile)
+        {
+            cout << "Warning: File \"" << filename << "\" already exists. Overwriting will replace its content.\n";
+            cout << "Do you want to proceed? (y/n): ";
+            cin >> confirmation;
+
+            if (confirmation == "n" || confirmation == "N")
+            {
+                cout << "Operation cancelled. Returning to menu.\n";
+                return;
+            }
+
+            else if (confirmation != "y" && confirmation != "Y")
+            {
+                cout << "Invalid input. Please enter 'y' or 'n'.\n";
+                checkFile.close();
+                continue;
+            }
+        }
+        checkFile.close();
+
+        // Attempt to open the file for writing
+        file.open(filename, ios::out | ios::trunc);
+        if (!file)
+        {
+            cout << "Error: Could not open file \"" << filename << "\" for writing. Please try again.\n";
+        }
+    } while (!file);
+
+    // Step 2: Save Data to File
+    cout << "Saving area data to \"" << filename << "\"...\n";
+    for (const auto& area : areas)
+    {
+        file << area.name << "," << area.address << "," << area.city << endl;
+
+        // Optional: Log each record saved
+        cout << "Log: Saved area \"" << area.name << "\" to file.\n";
+    }
+    file.close();
+    cout << "Area data successfully saved to file \"" << filename << "\".\n";
+
+    // Step 3: Backup Option
+    char createBackup;
+    cout << "Would you like to create a backup of this file? (y/n): ";
+    cin >> createBackup;
+
+    if (createBackup == 'y' || createBackup == 'Y')
+    {
+        string backupFilename = filename + ".bak";
+        ifstream sourceFile(filename, ios::binary);
+        ofstream backupFile(backupFilename, ios::binary);
+
+        if (sourceFile && backupFile)
+        {
+            backupFile << sourceFile.rdbuf();
+            sourceFile.close();
+            backupFile.close();
+            cout << "Backup file \"" << backupFilename << "\" created successfully.\n";
+        }
+
+        else
+        {
+            cout << "Error: Unable to create backup file \"" << backupFilename << "\".\n";
+        }
+    }
+
+}
+
+    void AreaDatabase::enterPopulationData()
+    {
+    int count;
+    cout << "Enter the number of areas for which you want to provide population data: ";
+
+    // Input validation for count
+    while (true) {
+        cin >> count;
+        if (count > 0) break;
+        else {
+            cout << "Invalid number. Please enter a positive integer: ";
+        }
+    }
+
+    populationData.clear();
+    areas.clearPopulation();
+
+    for (int i = 0; i < count; ++i)
+    {
+        string areaName;
+        double population;
+        char editOption;
+
+        cout << "\nEnter area name #" << (i + 1) << ": ";
+        cin.ignore();
+        getline(cin, areaName);
+
+        // Remove any extra spaces from the area name
+        areaName.erase(remove(areaName.begin(), areaName.end(), ' '), areaName.end());
+
+        // Input validation for population
+        while (true) {
+            cout << "Enter population for " << areaName << ": ";
+            cin >> population;
+            if (population >= 0) break;
+
+            else
+            {
+                cout << "Population cannot be negative. Please enter a valid population: ";
+            }
+        }
+
+        // Check if the area name already exists in the population data
+        auto it = populationData.find(areaName);
+
+        if (it != populationData.end())
+        {
+            cout << "Population data already exists for \"" << areaName << "\". Do you want to update it? (y/n): ";
+            cin >> editOption;
+
+            // If user wants to update existing data
+            if (editOption == 'y' || editOption == 'Y')
+            {
+                populationData[areaName] = population;
+                attachPopulation(areaName);
+                cout << "Population data for \"" << areaName << "\" updated successfully.\n";
+            }
+
+             else
+            {
+                cout << "Population data for \"" << areaName << "\" not changed.\n";
+            }
+        }
+         else
+        {
+            // Otherwise, add the new data
+            populationData[areaName] = population;
+            attachPopulation(areaName);
+            cout << "Population data for \"" << areaName << "\" added successfully.\n";
+        }
+
+        // Ask if user wants to add more population data
+        char addMore;
+        cout << "\nDo you want to add population data for another area? (y/n): ";
+        cin >> addMore;
+
+        if (addMore == 'n' || addMore == 'N')
+        {
+            break; // Exit the loop if user does not want to add more data
+        }
+
+        else if (addMore != 'y' && addMore != 'Y')
+        {
+            cout << "Invalid input. Please enter 'y' for yes or 'n' for no.\n";
+            // Keep asking until valid input
+            while (true) {
+                cout << "\nDo you want to add population data for another area? (y/n): ";
+                cin >> addMore;
+                if (addMore == 'y' || addMore == 'Y') break;
+                else if (addMore == 'n' || addMore == 'N') break;
+
+                else
+                {
+                    cout << "Invalid input. Please enter 'y' for yes or 'n' for no.\n";
+                }
+            }
+        }
+    }
+
+    // Ask the user if they want to save the population data to a file
+    char saveOption;
+    cout << "\nWould you like to save the population data to a file? (y/n): ";
+    cin >> saveOption;
+
+    if (saveOption == 'y' || saveOption == 'Y')
+    {
+        string filename;
+        ofstream file;
+
+        // Step 1: Get filename from user
+        cout << "Enter filename to save population data: ";
+        cin >> filename;
+
+        file.open(filename, ios::out | ios::trunc);
+
+        // Step 2: Check if file is opened successfully
+        if (!file)
+        {
+            cout << "Error: Could not open file for saving population data. Please check the file path and try again.\n";
+            return;
+        }
+
+        // Step 3: Save data to the file
+        cout << "Saving population data to \"" << filename << "\"...\n";
+        file << "Area Name, Population\n"; // Header
+
+        for (const auto& entry : populationData)
+        {
+            file << entry.first << "," << entry.second << endl;
+            cout << "Log: Saved population data for \"" << entry.first << "\" to file.\n";
+        }
+
+        file.close();
+        cout << "Population data successfully saved to \"" << filename << "\".\n";
+    }
+
+    // Step 4: Provide options for editing or deleting entries
+    char editDeleteOption;
+    cout << "\nWould you like to edit or delete any population data? (e/d/n): ";
+    cin >> editDeleteOption;
+
+    if (editDeleteOption == 'e' || editDeleteOption == 'E')
+    {
+        string editAreaName;
+        cout << "Enter the area name to edit: ";
+        cin.ignore();
+        getline(cin, editAreaName);
+
+        auto it = populationData.find(editAreaName);
+        if (it != populationData.end())
+        {
+            double newPopulation;
+            cout << "Enter the new population for \"" << editAreaName << "\": ";
+            cin >> newPopulation;
+            it->second = newPopulation;
+            attachPopulation(it->first);
+            cout << "Population for \"" << editAreaName << "\" updated successfully.\n";
+        }
+
+        else
+        {
+            cout << "Area \"" << editAreaName << "\" not found in the population data.\n";
+        }
+
+    }
+     else if (editDeleteOption == 'd' || editDeleteOption == 'D') {
+        string deleteAreaName;
+        cout << "Enter the area name to delete: ";
+        cin.ignore();
+        getline(cin, deleteAreaName);
+
+        auto it = populationData.find(deleteAreaName);
+        if (it != populationData.end())
+        {
+            populationData.erase(it);
+            attachPopulation(deleteAreaName);
+            cout << "Population data for \"" << deleteAreaName << "\" deleted successfully.\n";
+        }
+
+        else
+        {
+            cout << "Area \"" << deleteAreaName << "\" not found in the population data.\n";
+        }
+    }
+
+     else if (editDeleteOption != 'n' && editDeleteOption != 'N')
+    {
+        cout << "Invalid option. Please enter 'e' for edit, 'd' for delete, or 'n' for none.\n";
+    }
+
+    cout << "\nPopulation data successfully entered and processed.\n";
+}
+// Prints the per-area waste generation table for the given rate
+// Returns false when there is no area or population data to report on
+bool AreaDatabase::printWasteGenerationTable(double wastePerCapita) const
+{
+    if (populationData.empty())
+    {
+        cout << "No population data available. Please load population data first.\n";
+        return false;
+    }
+
+    if (areas.empty())
+    {
+        cout << "No area data available. Please load area data first.\n";
+        return false;
+    }
+
+    // Displaying header for waste calculation
+    cout << left << setw(30) << "Area Name"
+         << setw(50) << "Address"
+         << setw(30) << "City"
+         << setw(20) << "Population"
+         << setw(20) << "Waste (kg/day)"
+         << setw(20) << "Waste (kg/year)"
+         << setw(20) << "Notes" << endl;
+
+    cout << string(170, '-') << endl;
+
+    // Calculate waste for each area
+    vector<double> waste;
+    scaleColumn(areas.populationColumn(), wastePerCapita, waste);
+    for (auto it = areas.begin(); it != areas.end(); ++it)
+    {
+        Area area = *it;
+        double population = areas.population(it.id());
+        if (AreaStore::hasPopulation(population))
+        {
+            double totalWastePerDay = waste[it.id()];
+            double totalWastePerYear = totalWastePerDay * 365;
+
+            // Check if the waste generation rate is too high or too low
+            string notes;
+
+            if (totalWastePerDay < 100)
+            {
+                notes = "Unrealistic low waste generation.";
+            }
+
+            else if (totalWastePerDay > 10000)
+            {
+                notes = "Unrealistic high waste generation.";
+            }
+
+            else
+            {
+                notes = "Normal waste generation.";
+            }
+
+            // Output detailed information for the area
+            cout << left << setw(30) << area.name
+                 << setw(50) << area.address
+                 << setw(30) << area.city
+                 << setw(20) << population
+                 << setw(20) << totalWastePerDay
+                 << setw(20) << totalWastePerYear
+                 << setw(20) << notes << endl;
+
+        }
+
+        else
+        {
+            // No population data found for the area
+            cout << left << setw(30) << area.name
+                 << setw(50) << area.address
+                 << setw(30) << area.city
+                 << setw(20) << "No data"
+                 << setw(20) << "No data"
+                 << setw(20) << "No data"
+                 << setw(20) << "No population data" << endl;
+        }
+    }
+
+    return true;
+}
+
+// Total waste generation (kg/day) over all areas that have population data
+double AreaDatabase::totalWasteGeneration(double wastePerCapita) const
+{
+    vector<double> waste;
+    scaleColumn(areas.populationColumn(), wastePerCapita, waste);
+    return summarizeColumn(waste).sum;
+}
+
+void AreaDatabase::calculateWasteGeneration() const {
+    // Average waste generation rate in kg per person per day
+    double wastePerCapita = 0.74;
+
+    // Input validation for custom waste per capita rate
+    char customRateOption;
+    cout << "Do you want to input a custom waste generation rate? (y/n): ";
+    cin >> customRateOption;
+
+    if (customRateOption == 'y' || customRateOption == 'Y')
+    {
+        cout << "Enter the waste generation rate in kg per person per day: ";
+        cin >> wastePerCapita;
+
+        // Validate the input rate
+        while (wastePerCapita <= 0) {
+            cout << "Invalid input. Waste generation rate must be greater than 0. Please try again: ";
+            cin >> wastePerCapita;
+        }
+        cout << "Custom waste generation rate set to " << wastePerCapita << " kg/day.\n";
+    }
+
+    if (!printWasteGenerationTable(wastePerCapita))
+    {
+        return;
+    }
+
+    // Provide additional information about the calculation
+    char furtherActionOption;
+    cout << "\nWould you like to perform additional actions on the waste generation data? (y/n): ";
+    cin >> furtherActionOption;
+
+    if (furtherActionOption == 'y' || furtherActionOption == 'Y')
+    {
+        vector<double> waste;
+        scaleColumn(areas.populationColumn(), wastePerCapita, waste);
+
+        // Let the user choose an action: filter data, calculate summary, etc.
+        char actionChoice;
+        cout << "Choose an action:\n";
+        cout << "1. View summary of total waste\n";
+        cout << "2. View areas with excessive waste generation\n";
+        cout << "3. Export data to file\n";
+        cout << "Enter choice (1-3): ";
+        cin >> actionChoice;
+
+        if (actionChoice == '1')
+        {
+            // Calculate the total waste generation for all areas
+            double totalWaste = summarizeColumn(waste).sum;
+            cout << "Total waste generation for all areas (kg/day): " << totalWaste << endl;
+        }
+
+         else if (actionChoice == '2')
+        {
+            // Filter areas with excessive waste generation (more than 1000 kg/day)
+            cout << "\nAreas with excessive waste generation (more than 1000 kg/day):\n";
+            for (auto it = areas.begin(); it != areas.end(); ++it)
+            {
+                double totalWastePerDay = waste[it.id()];
+                if (totalWastePerDay > 1000)
+                {
+                    cout << (*it).name << " (" << totalWastePerDay << " kg/day)\n";
+                }
+            }
+        }
+
+        else if (actionChoice == '3')
+        {
+            // Export data to a file
+            string filename;
+            cout << "Enter filename to save the waste data: ";
+            cin >> filename;
+            ofstream file(filename);
+
+            if (!file)
+            {
+                cout << "Error: Could not open file for writing. Please check the file path.\n";
+                return;
+            }
+
+            file << "Area Name, Address, City, Population, Waste (kg/day), Waste (kg/year), Notes\n";
+            for (auto it = areas.begin(); it != areas.end(); ++it)
+            {
+                Area area = *it;
+                double population = areas.population(it.id());
+                if (AreaStore::hasPopulation(population))
+                {
+                    double totalWastePerDay = waste[it.id()];
+                    double totalWastePerYear = totalWastePerDay * 365;
+                    string notes;
+
+                    if (totalWastePerDay < 100)
+                    {
+                        notes = "Unrealistic low waste generation.";
+                    }
+
+                    else if (totalWastePerDay > 10000)
+                    {
+                        notes = "Unrealistic high waste generation.";
+                    }
+
+                    else
+                    {
+                        notes = "Normal waste generation.";
+                    }
+
+                    file << area.name << "," << area.address << "," << area.city << ","
+                         << population << "," << totalWastePerDay << "," << totalWastePerYear << "," << notes << endl;
+                }
+            }
+
+            file.close();
+            cout << "Waste data successfully saved to \"" << filename << "\".\n";
+        }
+        else
+        {
+            cout << "Invalid choice. Returning to the main menu.\n";
+        }
+    }
+
+    cout << "\nWaste generation calculations are complete.\n";
+}
+void AreaDatabase::sortAreasByName()
+{
+    if (areas.empty())
+    {
+        cout << "No areas to sort. Please load area data first.\n";
+        return;
+    }
+
+    // User chooses the sorting order
+    char orderChoice;
+    cout << "Choose sorting order:\n";
+    cout << "1. Ascending (A-Z)\n";
+    cout << "2. Descending (Z-A)\n";
+    cout << "Enter your choice (1/2): ";
+    cin >> orderChoice;
+
+    if (orderChoice != '1' && orderChoice != '2')
+    {
+        cout << "Invalid choice. Please enter 1 or 2.\n";
+        return;
+    }
+
+    // Read the order off the name index; the stored order is left as it is
+    vector<Area> sortedAreas;
+    sortedAreas.reserve(areas.size());
+    if (orderChoice == '1')
+    {
+        for (auto it = areas.byName().begin(); it != areas.byName().end(); ++it)
+        {
+            sortedAreas.push_back(areas[*it]);
+        }
+        cout << "Areas sorted in ascending order by name.\n";
+    }
+
+    else
+    {
+        for (auto it = areas.byName().rbegin(); it != areas.byName().rend(); ++it)
+        {
+            sortedAreas.push_back(areas[*it]);
+        }
+        cout << "Areas sorted in descending order by name.\n";
+    }
+
+    // Display the sorted list
+    cout << "\nSorted Areas:\n";
+    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+    cout << string(110, '-') << endl;
+    for (const auto& area : sortedAreas)
+    {
+        cout << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
+    }
+
+    // Additional options after sorting
+    char furtherActionOption;
+    cout << "\nWould you like to perform further actions on the sorted list? (y/n): ";
+    cin >> furtherActionOption;
+
+    if (furtherActionOption == 'y' || furtherActionOption == 'Y')
+    {
+        char actionChoice;
+        cout << "\nChoose an action:\n";
+        cout << "1. Save the sorted list to a file\n";
+        cout << "2. Filter areas by starting letter\n";
+        cout << "3. Search for an area by name\n";
+        cout << "Enter your choice (1/2/3): ";
+        cin >> actionChoice;
+
+        if (actionChoice == '1')
+        {
+            // Save the sorted list to a file
+            string filename;
+            cout << "Enter filename to save the sorted list: ";
+            cin >> filename;
+            ofstream file(filename);
+
+            if (!file)
+            {
+                cout << "Error: Could not open file for writing. Please check the file path.\n";
+                return;
+            }
+
+            file << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+            file << string(110, '-') << endl;
+
+            for (const auto& area : sortedAreas)
+            {
+                file << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
+            }
+
+            file.close();
+            cout << "Sorted list successfully saved to \"" << filename << "\".\n";
+
+        }
+
+        else if (actionChoice == '2')
+        {
+            // Filter areas by starting letter
+            char filterLetter;
+            cout << "Enter the starting letter to filter areas: ";
+            cin >> filterLetter;
+
+            cout << "\nFiltered Areas Starting with '" << filterLetter << "':\n";
+            cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+            cout << string(110, '-') << endl;
+
+            bool found = false;
+            for (const auto& area : sortedAreas)
+            {
+                if (!area.name.empty() && tolower(static_cast<unsigned char>(area.name[0])) == tolower(static_cast<unsigned char>(filterLetter)))
+                {
+                    found = true;
+                    cout << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
+                }
+            }
+
+            if (!found)
+            {
+                cout << "No areas found starting with '" << filterLetter << "'.\n";
+            }
+
+        }
+
+        else if (actionChoice == '3')
+        {
+            // Search for an area by name
+            string searchName;
+            cout << "Enter the area name to search for: ";
+            cin.ignore();
+            getline(cin, searchName);
+
+            cout << "\nSearch Results:\n";
+            cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+            cout << string(110, '-') << endl;
+
+            bool found = false;
+            for (const auto& area : sortedAreas)
+            {
+                if (area.name.find(searchName) != string::npos)
+                {
+                    found = true;
+                    cout << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
+                }
+            }
+
+            if (!found)
+            {
+                cout << "No areas found containing \"" << searchName << "\".\n";
+            }
+
+        }
+
+         else
+        {
+            cout << "Invalid choice. Returning to the main menu.\n";
+        }
+    }
+
+    cout << "\nSorting operation complete.\n";
+}
+void AreaDatabase::filterAreasByCity()
+{
+    if (areas.empty())
+    {
+        cout << "No area data available. Please load data first.\n";
+        return;
+    }
+
+    string city;
+    cout << "Enter the city to filter areas: ";
+    cin.ignore();
+    getline(cin, city);
+
+    // Convert input city to lowercase for case-insensitive comparison
+    city = foldCase(city);
+
+    cout << "\nAreas in \"" << city << "\":\n";
+    cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+    cout << string(110, '-') << endl;
+
+    bool found = false;
+    // The city's areas are a read of the folded city index, not a scan of every area
+    const vector<AreaStore::Id>& inCity = areas.inFoldedCity(city);
+    for (AreaStore::Id id : inCity)
+    {
+        found = true;
+        areas[id].display();
+    }
+
+    if (!found)
+    {
+        cout << "No areas found in \"" << city << "\".\n";
+        return;
+    }
+
+    // Additional options after displaying the filtered list
+    char furtherActionOption;
+    cout << "\nWould you like to perform additional actions on the filtered areas? (y/n): ";
+    cin >> furtherActionOption;
+
+    if (furtherActionOption == 'y' || furtherActionOption == 'Y')
+    {
+        char actionChoice;
+        cout << "\nChoose an action:\n";
+        cout << "1. Save the filtered areas to a file\n";
+        cout << "2. Display the total number of areas in the city\n";
+        cout << "3. Search filtered areas by name\n";
+        cout << "Enter your choice (1/2/3): ";
+        cin >> actionChoice;
+
+        if (actionChoice == '1')
+        {
+            // Save the filtered areas to a file
+            string filename;
+            cout << "Enter filename to save the filtered list: ";
+            cin >> filename;
+
+            ofstream file(filename);
+            if (!file)
+            {
+                cout << "Error: Could not open file for writing. Please check the file path.\n";
+                return;
+            }
+
+            file << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+            file << string(110, '-') << endl;
+
+            for (AreaStore::Id id : inCity)
+            {
+                const Area area = areas[id];
+                file << left << setw(30) << area.name << setw(50) << area.address << setw(30) << area.city << endl;
+            }
+
+            file.close();
+            cout << "Filtered list successfully saved to \"" << filename << "\".\n";
+
+        }
+
+        else if (actionChoice == '2')
+        {
+            // Count the total number of areas in the city
+            size_t count = inCity.size();
+
+            cout << "Total number of areas in \"" << city << "\": " << count << "\n";
+
+        }
+
+         else if (actionChoice == '3')
+        {
+            // Search filtered areas by name
+            string searchName;
+            cout << "Enter the area name to search within \"" << city << "\": ";
+            cin.ignore();
+            getline(cin, searchName);
+
+            cout << "\nSearch Results:\n";
+            cout << left << setw(30) << "Area Name" << setw(50) << "Address" << setw(30) << "City" << endl;
+            cout << string(110, '-') << endl;
+
+            bool foundInSearch = false;
+            for (AreaStore::Id id : inCity)
+            {
+                const Area area = areas[id];
+                if (area.name.find(searchName) != string::npos)
+                {
+                    foundInSearch = true;
+                    area.display();
+                }
+            }
+
+            if (!foundInSearch)
+            {
+                cout << "No areas found with the name \"" << searchName << "\" in \"" << city << "\".\n";
+            }
+
+        }
+
+        else
+        {
+            cout << "Invalid choice. Returning to the main menu.\n";
+        }
+    }
+
+    cout << "\nFiltering operation complete.\n";
+}
+void AreaDatabase::exportToCSV() const {
+    if (areas.empty())
+    {
+        cout << "No area data available to export. Please load data first.\n";
+        return;
+    }
+
+    string filename;
+    cout << "Enter filename for export (e.g., areas.csv): ";
+    cin >> filename;
+
+    ofstream file(filename);
+    if (!file)
+    {
+        cout << "Error: Could not open file \"" << filename << "\" for export.\n";
+        return;
+    }
+
+    // Ask the user if they want to export all columns or select specific ones
+    char exportChoice;
+    cout << "Do you want to export all columns? (y/n): ";
+    cin >> exportChoice;
+
+    bool exportAll = (exportChoice == 'y' || exportChoice == 'Y');
+    vector<string> columnsToExport;
+
+    if (!exportAll)
+    {
+        cout << "Select columns to export:\n";
+        cout << "1. Area Name\n";
+        cout << "2. Address\n";
+        cout << "3. City\n";
+        cout << "Enter column numbers separated by spaces (e.g., 1 2): ";
+
+        cin.ignore();
+        string columnInput;
+        getline(cin, columnInput);
+
+        istringstream iss(columnInput);
+        int columnNum;
+        while (iss >> columnNum) {
+            if (columnNum == 1) columnsToExport.push_back("Area Name");
+            else if (columnNum == 2) columnsToExport.push_back("Address");
+            else if (columnNum == 3) columnsToExport.push_back("City");
+            else {
+                cout << "Invalid column number: " << columnNum << ". Skipping.\n";
+            }
+        }
+
+        if (columnsToExport.empty())
+        {
+            cout << "No valid columns selected. Export cancelled.\n";
+            return;
+        }
+    }
+
+    else
+    {
+        columnsToExport = {"Area Name", "Address", "City"};
+    }
+
+    // Write the CSV header
+    for (size_t i = 0; i < columnsToExport.size(); ++i)
+    {
+        file << columnsToExport[i];
+        if (i < columnsToExport.size() - 1) file << ",";
+    }
+    file << "\n";
+
+    // Ask the user if they want to filter data by city before exporting
+    char filterChoice;
+    cout << "Do you want to filter data by city before export? (y/n): ";
+    cin >> filterChoice;
+
+    string filterCity;
+    bool applyFilter = (filterChoice == 'y' || filterChoice == 'Y');
+    if (applyFilter)
+    {
+        cout << "Enter the city to filter by: ";
+        cin.ignore();
+        getline(cin, filterCity);
+        filterCity = foldCase(filterCity);
+    }
+
+    // Write the data
+    bool found = false;
+    auto writeRow = [&](const Area& area)
+    {
+        found = true;
+
+        for (size_t i = 0; i < columnsToExport.size(); ++i)
+        {
+            if (columnsToExport[i] == "Area Name") file << area.name;
+            else if (columnsToExport[i] == "Address") file << area.address;
+            else if (columnsToExport[i] == "City") file << area.city;
+
+            if (i < columnsToExport.size() - 1) file << ",";
+        }
+        file << "\n";
+    };
+
+    if (applyFilter)
+    {
+        for (AreaStore::Id id : areas.inFoldedCity(filterCity))
+        {
+            writeRow(areas[id]);
+        }
+    }
+    else
+    {
+        for (const auto& area : areas)
+        {
+            writeRow(area);
+        }
+    }
+
+    if (!found && applyFilter)
+    {
+        cout << "No data found for the specified city \"" << filterCity << "\".\n";
+    }
+
+    file.close();
+    cout << "Data exported to \"" << filename << "\" successfully.\n";
+
+    // Ask if the user wants to view the exported data
+    char viewChoice;
+    cout << "Do you want to view the exported file? (y/n): ";
+    cin >> viewChoice;
+
+    if (viewChoice == 'y' || viewChoice == 'Y')
+    {
+        ifstream viewFile(filename);
+        if (viewFile)
+        {
+            cout << "\nExported Data:\n";
+            string line;
+            while (getline(viewFile, line)) {
+                cout << line << "\n";
+            }
+            viewFile.close();
+        }
+
+        else
+        {
+            cout << "Error: Could not open file \"" << filename << "\" for viewing.\n";
+        }
+    }
+}
+void AreaDatabase::calculateAveragePopulation() const
+ {
+    if (populationData.empty())
+    {
+        cout << "No population data available. Please enter population data first.\n";
+        return;
+    }
+
+    // Display options for filtering data before calculation
+    char filterChoice;
+    cout << "Do you want to calculate the average population for all areas or filter by city? (a: All, c: City): ";
+    cin >> filterChoice;
+
+    // The populations considered, as one column
+    vector<double> populations;
+
+    if (filterChoice == 'c' || filterChoice == 'C')
+    {
+        // Filter by city
+        string filterCity;
+        cout << "Enter the city to calculate the average population for: ";
+        cin.ignore();
+        getline(cin, filterCity);
+        filterCity = foldCase(filterCity);
+
+        const vector<AreaStore::Id>& ids = areas.inFoldedCity(filterCity);
+        populations.reserve(ids.size());
+        for (AreaStore::Id id : ids)
+        {
+            populations.push_back(areas.population(id));
+        }
+
+        if (summarizeColumn(populations).count == 0)
+        {
+            cout << "No population data found for areas in the city \"" << filterCity << "\".\n";
+            return;
+        }
+
+        cout << "Calculating average population for city \"" << filterCity << "\"...\n";
+    }
+
+    else
+    {
+        // Calculate for all areas
+        cout << "Calculating average population for all areas...\n";
+        populations.reserve(populationData.size());
+        for (const auto& entry : populationData)
+        {
+            populations.push_back(entry.second);
+        }
+    }
+
+    ColumnStats stats = summarizeColumn(populations);
+    double totalPopulation = stats.sum;
+    int count = static_cast<int>(stats.count);
+
+    // Calculate average population
+    double averagePopulation = totalPopulation / count;
+    cout << "Total Population: " << totalPopulation << endl;
+    cout << "Number of Areas Considered: " << count << endl;
+    cout << "The average population is: " << averagePopulation << endl;
+
+    // Additional feature: Save results to a file
+    char saveChoice;
+    cout << "Do you want to save the results to a file? (y/n): ";
+    cin >> saveChoice;
+
+    if (saveChoice == 'y' || saveChoice == 'Y')
+    {
+        string filename;
+        cout << "Enter the filename to save results (e.g., average_population.txt): ";
+        cin >> filename;
+
+        ofstream file(filename);
+        if (!file)
+        {
+            cout << "Error: Could not open file \"" << filename << "\" for writing.\n";
+            return;
+        }
+string filterCity;
+        file << "Population Analysis Results\n";
+        file << "----------------------------\n";
+        file << "Total Population: " << totalPopulation << "\n";
+        file << "Number of Areas Considered: " << count << "\n";
+        file << "Average Population: " << averagePopulation << "\n";
+
+        if (filterChoice == 'c' || filterChoice == 'C')
+        {
+            file << "Filtered City: " << filterCity << "\n";
+        } else {
+            file << "Filter: None (All Areas Considered)\n";
+        }
+
+        file.close();
+        cout << "Results saved to \"" << filename << "\" successfully.\n";
+    }
+
+    // Additional feature: Display histogram of population distribution
+    char histogramChoice;
+    cout << "Do you want to view a population histogram? (y/n): ";
+    cin >> histogramChoice;
+
+    if (histogramChoice == 'y' || histogramChoice == 'Y') {
+        cout << "\nPopulation Histogram:\n";
+        cout << left << setw(20) << "Area Name" << setw(20) << "Population" << endl;
+        cout << string(40, '-') << endl;
+
+        for (const auto& entry : populationData) {
+            cout << left << setw(20) << entry.first << setw(20) << entry.second << endl;
+        }
+
+        cout << "\nHistogram displayed successfully.\n";
+    }
+}
+void AreaDatabase::printPopulationStats() const {
+    if (populationData.empty())
+    {
+        cout << "No population data available.\n";
+        return;
+    }
+
+    // Display population statistics
+    cout << "Population Statistics:\n";
+    cout << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
+    cout << string(50, '-') << endl;
+
+    // The entries as a name list and a population column, in listing order
+    vector<const string*> names;
+    vector<double> populations;
+    names.reserve(populationData.size());
+    populations.reserve(populationData.size());
+    for (const auto& entry : populationData) {
+        cout << left << setw(30) << entry.first << setw(20) << entry.second << endl;
+        names.push_back(&entry.first);
+        populations.push_back(entry.second);
+    }
+
+    // Calculate total, minimum, maximum, and average population
+    ColumnStats stats = summarizeColumn(populations);
+    double totalPopulation = stats.sum;
+    double minPopulation = stats.min;
+    double maxPopulation = stats.max;
+    const string& minArea = *names[stats.minAt];
+    const string& maxArea = *names[stats.maxAt];
+
+    double averagePopulation = totalPopulation / stats.count;
+
+    cout << "\nSummary Statistics:\n";
+    cout << "-------------------\n";
+    cout << "Total Population: " << totalPopulation << endl;
+    cout << "Average Population: " << averagePopulation << endl;
+    cout << "Minimum Population: " << minPopulation << " (Area: " << minArea << ")\n";
+    cout << "Maximum Population: " << maxPopulation << " (Area: " << maxArea << ")\n";
+
+    // Option to filter data by a population range
+    char filterChoice;
+    cout << "\nDo you want to filter areas by population range? (y/n): ";
+    cin >> filterChoice;
+
+    if (filterChoice == 'y' || filterChoice == 'Y')
+    {
+        double lowerBound, upperBound;
+        cout << "Enter the lower bound for population: ";
+        cin >> lowerBound;
+        cout << "Enter the upper bound for population: ";
+        cin >> upperBound;
+
+        cout << "\nAreas with population in the range [" << lowerBound << ", " << upperBound << "]:\n";
+        cout << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
+        cout << string(50, '-') << endl;
+
+        for (const auto& entry : populationData)
+        {
+            if (entry.second >= lowerBound && entry.second <= upperBound)
+            {
+                cout << left << setw(30) << entry.first << setw(20) << entry.second << endl;
+            }
+        }
+    }
+
+    // Option to save statistics to a file
+    char saveChoice;
+    cout << "\nDo you want to save the statistics to a file? (y/n): ";
+    cin >> saveChoice;
+
+    if (saveChoice == 'y' || saveChoice == 'Y')
+    {
+        string filename;
+        cout << "Enter the filename for saving statistics (e.g., population_stats.txt): ";
+        cin >> filename;
+
+        ofstream file(filename);
+        if (!file)
+        {
+            cout << "Error: Could not open file \"" << filename << "\" for writing.\n";
+            return;
+        }
+
+        file << "Population Statistics:\n";
+        file << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
+        file << string(50, '-') << endl;
+
+        for (const auto& entry : populationData)
+        {
+            file << left << setw(30) << entry.first << setw(20) << entry.second << endl;
+        }
+
+        file << "\nSummary Statistics:\n";
+        file << "-------------------\n";
+        file << "Total Population: " << totalPopulation << endl;
+        file << "Average Population: " << averagePopulation << endl;
+        file << "Minimum Population: " << minPopulation << " (Area: " << minArea << ")\n";
+        file << "Maximum Population: " << maxPopulation << " (Area: " << maxArea << ")\n";
+
+        double lowerBound, upperBound;
+        if (filterChoice == 'y' || filterChoice == 'Y')
+        {
+            file << "\nFiltered Areas (Range: [" << lowerBound << ", " << upperBound << "]):\n";
+            file << left << setw(30) << "Area Name" << setw(20) << "Population" << endl;
+            file << string(50, '-') << endl;
+
+            for (const auto& entry : populationData)
+            {
+                if (entry.second >= lowerBound && entry.second <= upperBound)
+                {
+                    file << left << setw(30) << entry.first << setw(20) << entry.second << endl;
+                }
+            }
+        }
+
+        file.close();
+        cout << "Statistics saved to \"" << filename << "\" successfully.\n";
+    }
+
+    // Option to visualize population distribution
+    char visualizeChoice;
+    cout << "\nDo you want to visualize the population distribution? (y/n): ";
+    cin >> visualizeChoice;
+
+    if (visualizeChoice == 'y' || visualizeChoice == 'Y')
+    {
+        cout << "\nPopulation Distribution:\n";
+        vector<int> bars;
+        barLengths(populations, maxPopulation, 50, bars);
+        for (size_t k = 0; k < names.size(); k++)
+        {
+            cout << left << setw(30) << *names[k] << " | ";
+            cout << string(bars[k], '*') << endl;
+        }
+    }
+}
+
+void AreaDatabase::calculateAverageWasteGeneration() const {
+    double wastePerCapita = 0.74; // Average waste generation rate in kg per person per day
+
+    if (populationData.empty())
+    {
+        cout << "No population data available. Please enter population data first.\n";
+        return;
+    }
+
+    vector<double> waste;
+    scaleColumn(areas.populationColumn(), wastePerCapita, waste);
+    ColumnStats stats = summarizeColumn(waste);
+    double totalWaste = stats.sum;
+    int areaCount = static_cast<int>(stats.count);
+
+    cout << "\n--- Waste Generation Report ---\n";
+    cout << left << setw(30) << "Area Name" << setw(20) << "Population" << setw(20) << "Waste (kg/day)" << endl;
+    cout << string(70, '-') << endl;
+
+    for (auto it = areas.begin(); it != areas.end(); ++it)
+    {
+        Area area = *it;
+        double population = areas.population(it.id());
+        if (AreaStore::hasPopulation(population))
+        {
+            double areaWaste = waste[it.id()];
+            cout << left << setw(30) << area.name << setw(20) << population << setw(20) << areaWaste << endl;
+        }
+
+        else
+        {
+            cout << left << setw(30) << area.name << setw(20) << "No data" << setw(20) << "N/A" << endl;
+        }
+    }
+
+    cout << string(70, '-') << endl;
+
+    if (areaCount > 0)
+    {
+        double averageWaste = totalWaste / areaCount;
+        cout << "\nThe average waste generation per area is: " << averageWaste << " kg/day.\n";
+    }
+
+    else
+    {
+        cout << "\nNo valid waste generation data available for the areas.\n";
+    }
+
+    // Additional insights (the waste column is indexed by area id)
+    double maxWaste = stats.max, minWaste = stats.min;
+    string maxArea, minArea;
+
+    if (areaCount > 0)
+    {
+        maxArea = string(areas[static_cast<AreaStore::Id>(stats.maxAt)].name);
+        minArea = string(areas[static_cast<AreaStore::Id>(stats.minAt)].name);
+        cout << "Highest waste generation: " << maxArea << " with " << maxWaste << " kg/day.\n";
+        cout << "Lowest waste generation: " << minArea << " with " << minWaste << " kg/day.\n";
+    }
+
+    // Optional: Save report
+    string filename;
+    cout << "\nWould you like to save the report to a file? (yes/no): ";
+    string response;
+    cin.ignore();
+    getline(cin, response);
+
+    if (response == "yes")
+    {
+        cout << "Enter the filename for the report: ";
+        getline(cin, filename);
+
+        ofstream reportFile(filename);
+        if (!reportFile)
+        {
+            cout << "Error: Unable to create the file \"" << filename << "\".\n";
+            return;
+        }
+
+        reportFile << "--- Waste Generation Report ---\n";
+        reportFile << left << setw(30) << "Area Name" << setw(20) << "Population" << setw(20) << "Waste (kg/day)" << endl;
+        reportFile << string(70, '-') << endl;
+
+        for (auto it = areas.begin(); it != areas.end(); ++it)
+        {
+            Area area = *it;
+            double population = areas.population(it.id());
+            if (AreaStore::hasPopulation(population))
+            {
+                double areaWaste = waste[it.id()];
+
+                reportFile << left << setw(30) << area.name << setw(20) << population << setw(20) << areaWaste << endl;
+            }
+
+             else
+            {
+                reportFile << left << setw(30) << area.name << setw(20) << "No data" << setw(20) << "N/A" << endl;
+            }
+        }
+
+        reportFile << string(70, '-') << endl;
+
+        if (areaCount > 0)
+        {
+            reportFile << "\nThe average waste generation per area is: " << totalWaste / areaCount << " kg/day.\n";
+            reportFile << "Highest waste generation: " << maxArea << " with " << maxWaste << " kg/day.\n";
+            reportFile << "Lowest waste generation: " << minArea << " with " << minWaste << " kg/day.\n";
+        }
+
+        else
+        {
+            reportFile << "\nNo valid waste generation data available for the areas.\n";
+        }
+
+        reportFile.close();
+        cout << "Report successfully saved to \"" << filename << "\".\n";
+    }
+
+    else
+    {
+        cout << "Report not saved.\n";
+    }
+}
+
+
+// Benchmark: area file throughput of readAreaFile against the getline and stringstream
+// reader it replaced, on a generated file of rows areas (every tenth address quoted)
+void benchmarkAreaCsv(int rows)
+{
+    if (rows <= 0)
+    {
+        return;
+    }
+
+    string filename = (filesystem::temp_directory_path() / "bench_areas.csv").string();
+    {
+        const char* cities[] = {"Belgaum", "Hubli", "Dharwad", "Gokak", "Bijapur", "Bagalkot"};
+        string text;
+        for (int k = 0; k < rows; k++)
+        {
+            text += "Ward " + to_string(k) + ",";
+            if (k % 10 == 0)
+                text += "\"" + to_string(k % 500) + ", Station Road \"\"Main\"\"\",";
+            else
+                text += to_string(k % 500) + " Market Road,";
+            text += cities[k % 6];
+            text += "\n";
+        }
+        ofstream out(filename, ios::binary);
+        out << text;
+    }
+    double megabytes = filesystem::file_size(filename) / 1e6;
+
+    auto seconds = [](auto run) {
+        auto start = chrono::steady_clock::now();
+        run();
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    };
+
+    size_t lineAreas = 0;
+    double lineSeconds = seconds([&] {
+        ifstream file(filename);
+        vector<array<string, 3>> parsed;
+        string line;
+        while (getline(file, line))
+        {
+            stringstream ss(line);
+            array<string, 3> fields;
+            if (getline(ss, fields[0], ',') && getline(ss, fields[1], ',') && getline(ss, fields[2]))
+                parsed.push_back(move(fields));
+        }
+        lineAreas = parsed.size();
+    });
+
+    size_t parsedAreas = 0;
+    vector<CsvError> errors;
+    double parseSeconds = seconds([&] {
+        CsvFile file;
+        file.open(filename);
+        file.forEachRecord([&parsedAreas](size_t, const vector<string_view>& fields) { parsedAreas += fields.size() == 3; }, errors);
+    });
+
+    // The whole load, including the area store's name and city indexes
+    AreaDatabase database;
+    double mappedSeconds = seconds([&] { database.readAreaFile(filename, errors); });
+    filesystem::remove(filename);
+
+    cout << "Area file: " << rows << " rows, " << megabytes << " MB\n";
+    cout << left << setw(28) << "Reader" << setw(12) << "MB/s" << setw(12) << "ms" << "Areas" << "\n";
+    cout << string(60, '-') << "\n";
+    cout << left << setw(28) << "getline + stringstream" << setw(12) << megabytes / lineSeconds << setw(12)
+         << lineSeconds * 1000 << lineAreas << " (quoted commas split the address)\n";
+    cout << left << setw(28) << "mapped CSV, parse only" << setw(12) << megabytes / parseSeconds << setw(12)
+         << parseSeconds * 1000 << parsedAreas << "\n";
+    cout << left << setw(28) << "mapped CSV + indexes" << setw(12) << megabytes / mappedSeconds << setw(12)
+         << mappedSeconds * 1000 << database.areaCount() << " (" << errors.size() << " errors)\n";
+}
+
+
+// Benchmark: cost of one case-insensitive city filter, lowercasing every area's city per
+// query as the filters used to against reading the folded city index. count areas spread
+// over 200 cities, each in three spellings ("Town7", "TOWN7", "town7")
+void benchmarkCityFilter(int count)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    deque<string> text;
+    vector<string> spellings;
+    for (int c = 0; c < 200; c++)
+    {
+        string city = "Town" + to_string(c);
+        spellings.push_back(city);
+        spellings.push_back(foldCase(city));
+        transform(city.begin(), city.end(), city.begin(), [](unsigned char c) { return static_cast<char>(toupper(c)); });
+        spellings.push_back(city);
+    }
+
+    AreaStore store;
+    store.reserve(count);
+    double buildSeconds = 0;
+    {
+        auto start = chrono::steady_clock::now();
+        for (int k = 0; k < count; k++)
+        {
+            text.push_back("Ward " + to_string(k));
+            store.add({text.back(), "Main Road", spellings[k % spellings.size()]});
+        }
+        buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    const int queries = 20;
+    auto microseconds = [queries](auto query, size_t& matches) {
+        matches = 0;
+        auto start = chrono::steady_clock::now();
+        for (int q = 0; q < queries; q++)
+        {
+            matches += query("town" + to_string(q * 7 % 200));
+        }
+        return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / queries;
+    };
+
+    size_t scanMatches = 0, indexMatches = 0;
+    double scanUs = microseconds([&store](const string& city) {
+        size_t found = 0;
+        for (const auto& area : store)
+        {
+            string areaCity(area.city);
+            transform(areaCity.begin(), areaCity.end(), areaCity.begin(), [](unsigned char c) { return static_cast<char>(tolower(c)); });
+            found += areaCity == city;
+        }
+        return found;
+    }, scanMatches);
+    // Visits each matching area, as the filters do when printing them
+    double indexUs = microseconds([&store](const string& city) {
+        size_t found = 0;
+        for (AreaStore::Id id : store.inFoldedCity(city))
+        {
+            found += !store[id].city.empty();
+        }
+        return found;
+    }, indexMatches);
+
+    cout << "Areas: " << count << " in " << spellings.size() << " city spellings (built with indexes in "
+         << buildSeconds * 1000 << " ms)\n";
+    cout << left << setw(28) << "City filter" << setw(18) << "us per query" << "Areas matched" << "\n";
+    cout << string(60, '-') << "\n";
+    cout << left << setw(28) << "lowercase every city" << setw(18) << scanUs << scanMatches << "\n";
+    cout << left << setw(28) << "folded city index" << setw(18) << indexUs << indexMatches << "\n";
+}
+
+
+// Benchmark: the statistics kernels against the scalar loops the reports used, over a
+// population column of count areas, one in eight without data
+void benchmarkPopulationStats(int count)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    vector<double> populations(count);
+    mt19937 random(7);
+    uniform_int_distribution<int> people(0, 60000);
+    for (double& population : populations)
+    {
+        population = random() % 8 == 0 ? AreaStore::NO_POPULATION : people(random);
+    }
+    const double wastePerCapita = 0.74;
+
+    const int runs = 5;
+    auto milliseconds = [runs](auto run) {
+        auto start = chrono::steady_clock::now();
+        for (int r = 0; r < runs; r++)
+        {
+            run();
+        }
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / runs;
+    };
+
+    ColumnStats loop, kernel;
+    double loopSummary = milliseconds([&] {
+        loop = ColumnStats();
+        loop.min = numeric_limits<double>::max();
+        loop.max = -numeric_limits<double>::max();
+        for (size_t k = 0; k < populations.size(); k++)
+        {
+            double population = populations[k];
+            if (AreaStore::hasPopulation(population))
+            {
+                loop.count++;
+                loop.sum += population;
+                if (population < loop.min)
+                {
+                    loop.min = population;
+                    loop.minAt = k;
+                }
+                if (population > loop.max)
+                {
+                    loop.max = population;
+                    loop.maxAt = k;
+                }
+            }
+        }
+    });
+    double kernelSummary = milliseconds([&] { kernel = summarizeColumn(populations); });
+
+    // Outputs sized up front for both, so neither pays for first touching its pages
+    vector<double> loopWaste(populations.size()), kernelWaste(populations.size());
+    double loopScale = milliseconds([&] {
+        for (size_t k = 0; k < populations.size(); k++)
+        {
+            loopWaste[k] = populations[k] * wastePerCapita;
+        }
+    });
+    double kernelScale = milliseconds([&] { scaleColumn(populations, wastePerCapita, kernelWaste); });
+
+    vector<int> loopBars(populations.size()), kernelBars(populations.size());
+    double loopBar = milliseconds([&] {
+        for (size_t k = 0; k < populations.size(); k++)
+        {
+            loopBars[k] = AreaStore::hasPopulation(populations[k]) ? static_cast<int>(populations[k] / kernel.max * 50) : 0;
+        }
+    });
+    double kernelBar = milliseconds([&] { barLengths(populations, kernel.max, 50, kernelBars); });
+
+    bool same = loop.count == kernel.count && loop.min == kernel.min && loop.max == kernel.max &&
+                loop.minAt == kernel.minAt && loop.maxAt == kernel.maxAt &&
+                fabs(loop.sum - kernel.sum) <= 1e-9 * fabs(loop.sum) &&
+                equal(loopWaste.begin(), loopWaste.end(), kernelWaste.begin(),
+                      [](double a, double b) { return a == b || (isnan(a) && isnan(b)); }) &&
+                loopBars == kernelBars;
+
+#ifdef AREA_STATS_SSE2
+    const char* kernels = "SSE2";
+#else
+    const char* kernels = "scalar fallback";
+#endif
+    cout << "Population column: " << count << " areas, " << kernel.count << " with data (kernels: " << kernels << ")\n";
+    cout << left << setw(28) << "Operation" << setw(14) << "loop ms" << setw(14) << "kernel ms" << "Speedup" << "\n";
+    cout << string(64, '-') << "\n";
+    cout << left << setw(28) << "sum, min, max" << setw(14) << loopSummary << setw(14) << kernelSummary
+         << loopSummary / kernelSummary << "x\n";
+    cout << left << setw(28) << "per-capita waste" << setw(14) << loopScale << setw(14) << kernelScale
+         << loopScale / kernelScale << "x\n";
+    cout << left << setw(28) << "bar lengths" << setw(14) << loopBar << setw(14) << kernelBar
+         << loopBar / kernelBar << "x\n";
+    cout << "Results " << (same ? "match" : "DIFFER") << " (sum " << kernel.sum << ", min " << kernel.min
+         << ", max " << kernel.max << ")\n";
+}
+
+
+int wastegeneration()
+{
+    AreaDatabase database;
+    database.displayWelcomeMessage();
+
+    int choice;
+
+    do {
+        cout << "\nMenu:\n";
+        cout << "1. Load Area Data from File\n";
+        cout << "2. Display All Areas\n";
+        cout << "3. Update Area Data\n";
+        cout << "4. Delete Area by Name\n";
+        cout << "5. Add New Area\n";
+        cout << "6. Save Area Data to File\n";
+        cout << "7. Enter Population Data\n";
+        cout << "8. Calculate Waste Generation\n";
+        cout << "9. Sort Areas by Name\n";
+        cout << "10. Filter Areas by City\n";
+        cout << "11. Export Data to CSV\n";
+        cout << "12. Calculate Average Population\n";
+        cout << "13. Print Population Stats\n";
+        cout << "14. Calculate Average Waste Generation\n"; // New option added
+        cout << "15. Exit\n";
+        cout << "Enter your choice: ";
+        cin >> choice;
+
+        switch (choice) {
+            case 1:
+                database.loadFromFile();
+                break;
+            case 2:
+                database.displayAllAreas();
+                break;
+            case 3:
+                database.updateAreaData();
+                break;
+            case 4:
+                database.deleteAreaByName();
+                break;
+            case 5:
+                database.addNewArea();
+                break;
+            case 6:
+                database.saveToFile();
+                break;
+            case 7:
+                database.enterPopulationData();
+                break;
+            case 8:
+                database.calculateWasteGeneration();
+                break;
+            case 9:
+                database.sortAreasByName();
+                break;
+            case 10:
+                database.filterAreasByCity();
+                break;
+            case 11:
+                database.exportToCSV();
+                break;
+            case 12:
+                database.calculateAveragePopulation();
+                break;
+            case 13:
+                database.printPopulationStats();
+                break;
+            case 14:
+                database.calculateAverageWasteGeneration(); // New case added
+                break;
+            case 15:
+                cout << "Exiting program...\n";
+                break;
+            default:
+                cout << "Invalid choice. Please try again.\n";
+        }
+    } while (choice != 15);
+
+    return 0;
+}
+
+
+
+//module3
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <limits>
+#include<iomanip>
+#include <algorithm>
+#include <cctype>
+#include <conio.h>
+#include <windows.h>
+
+// Define color codes using ANSI escape sequences
+#define RESET "\033[0m"
+#define RED "\033[31m"
+#define GREEN "\033[32m"
+#define YELLOW "\033[33m"
+#define BLUE "\033[34m"
+#define MAGENTA "\033[35m"
+#define CYAN "\033[36m"
+#define WHITE "\033[37m"
+#define BOLD "\033[1m"
+
+
+using namespace std;
+
+// Structure to store waste data
+struct Wastes
+{
+    // Type of waste (e.g., plastic, paper, etc.)
+    std::string type;
+
+    int quantity;
+
+     // Location where the waste is stored
+    std::string location;
+
+     // Date when the waste was recorded
+    std::string date;
+
+     // Condition of the waste (e.g., clean, contaminated)
+    std::string condition;
+};
+
+// Structure to store factory records
+struct FactoryRecord
+{
+     // Type of waste sent to the factory
+
+    std::string wasteType;
+     // Total quantity sent
+
+    int totalQuantity;
+     // Factory name
+
+    std::string factoryName;
+     // Factory location
+
+    std::string factoryLocation;
+};
+
+// Global containers to store records
+std::vector<Wastes> wasteRecords;
+std::vector<FactoryRecord> factoryRecords;
+
+// Function prototypes
+void loadCSV(const std::string& filePath);
+void displayWasteRecords();
+void displayMenu();
+void searchWasteByType();
+void sortWasteRecords();
+void calculateStatistics();
+void saveToCSV(const std::string& filePath);
+void updateWasteRecord();
+void deleteWasteRecord();
+void addNewWasteRecord();
+void sendWasteToFactory();
+int sendWasteToFactory(std::string wasteType, int quantityToSend, const std::string& factoryName, const std::string& factoryLocation);
+void viewFactoryRecords();
+void validateInput(int& input, const std::string& prompt);
+void validateInput(std::string& input, const std::string& prompt);
+void displayFactoryRecords();
+void displayFactoryRecordsByType(const std::string& wasteType);
+void sortFactoryRecordsByQuantity();
+void sortFactoryRecordsByName();
+void sortFactoryRecordsByLocation();
+void displayFactoryRecordsInTable();
+void filterFactoryRecordsByCondition();
+void exportFactoryRecordsToCSV();
+void saveToCSV(const std::string& filePath);
+
+
+
+
+// Function to load data from a CSV file
+void loadCSV(const std::string& filePath)
+ {
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Could not open file at " << filePath << std::endl;
+        return;
+    }
+
+    std::string line;
+    bool isHeader = true;
+
+    // Reading the file line by line
+    while (std::getline(file, line))
+     {
+        if (isHeader)
+        {
+            isHeader = false;  // Skip the header line
+            continue;
+        }
+
+        // Split the line by commas and store data
+        std::stringstream ss(line);
+        std::string type, quantityStr, location, date, condition;
+        int dayNumber;
+
+        if (std::getline(ss, type, ',') &&
+            std::getline(ss, quantityStr, ',') &&
+            std::getline(ss, location, ',') &&
+            std::getline(ss, date, ',') &&
+            std::getline(ss, condition, ',') &&
+            parseDate(date, DateFormat::YearMonthDay, dayNumber))
+        {
+            Wastes waste = {type, std::stoi(quantityStr), location, date, condition};
+             // Add the waste record
+            wasteRecords.push_back(waste);
+        }
+        else
+        {
+            std::cerr << "Malformed line in CSV file.\n";
+        }
+    }
+
+    file.close();
+    std::cout << "Data loaded successfully from the CSV file!\n";
+}
+
+// Function to display waste records
+// Function to display waste records with options to filter, sort, and format outputt
+// Function to display waste records in various formats
+void displayWasteRecords()
+{
+    if (wasteRecords.empty())
+    {
+        std::cout << "No records to display!\n";
+        return;
+    }
+
+    int choice;
+    bool continueDisplaying = true;
+
+    while (continueDisplaying)
+    {
+        std::cout << "\nChoose an option to display waste records:\n";
+        std::cout << "1. View All Waste Records\n";
+        std::cout << "2. View Waste Records by Condition\n";
+        std::cout << "3. View Waste Records by Location\n";
+        std::cout << "4. View Waste Records in Table Format\n";
+        std::cout << "5. Back to Main Menu\n";
+        std::cout << "Enter your choice: ";
+        std::cin >> choice;
+
+        switch (choice)
+         {
+            case 1:
+                // Display all records without formatting
+                std::cout << "\nLoaded Waste Records:\n";
+                std::cout << "--------------------------------------------\n";
+                for (const auto& waste : wasteRecords)
+                {
+                    std::cout << "Type: " << waste.type
+                              << ", Quantity: " << waste.quantity
+                              << ", Location: " << waste.location
+                              << ", Date: " << waste.date
+                              << ", Condition: " << waste.condition << '\n';
+                }
+                std::cout << "--------------------------------------------\n";
+                break;
+
+            case 2:
+            {
+                // Filter records by condition
+                std::string conditionFilter;
+                std::cout << "Enter the condition to filter by (e.g., clean, contaminated): ";
+                std::cin.ignore(); // Clear input buffer before reading string
+                std::getline(std::cin, conditionFilter);
+
+                bool found = false;
+                std::cout << "\nFiltered Waste Records by Condition (" << conditionFilter << "):\n";
+                std::cout << "--------------------------------------------\n";
+                for (const auto& waste : wasteRecords)
+                {
+                    if (waste.condition == conditionFilter)
+                    {
+                        std::cout << "Type: " << waste.type
+                                  << ", Quantity: " << waste.quantity
+                                  << ", Location: " << waste.location
+                                  << ", Date: " << waste.date
+                                  << ", Condition: " << waste.condition << '\n';
+                        found = true;
+                    }
+                }
+                if (!found)
+                {
+                    std::cout << "No records found for condition: " << conditionFilter << '\n';
+                }
+                std::cout << "--------------------------------------------\n";
+                break;
+            }
+
+            case 3:
+                {
+                // Filter records by location
+                std::string locationFilter;
+                std::cout << "Enter the location to filter by: ";
+                std::cin.ignore(); // Clear input buffer before reading string
+                std::getline(std::cin, locationFilter);
+
+                bool found = false;
+                std::cout << "\nFiltered Waste Records by Location (" << locationFilter << "):\n";
+                std::cout << "--------------------------------------------\n";
+                for (const auto& waste : wasteRecords)
+                 {
+                    if (waste.location == locationFilter)
+                    {
+                        std::cout << "Type: " << waste.type
+                                  << ", Quantity: " << waste.quantity
+                                  << ", Location: " << waste.location
+                                  << ", Date: " << waste.date
+                                  << ", Condition: " << waste.condition << '\n';
+                        found = true;
+                    }
+                }
+                if (!found)
+                {
+                    std::cout << "No records found for location: " << locationFilter << '\n';
+                }
+                std::cout << "--------------------------------------------\n";
+                break;
+            }
+
+            case 4:
+            {
+                // View waste records in table format
+                std::cout << "\nWaste Records in Table Format:\n";
+                std::cout << std::setw(15) << std::left << "Type"
+                          << std::setw(10) << "Quantity"
+                          << std::setw(20) << "Location"
+                          << std::setw(15) << "Date"
+                          << std::setw(15) << "Condition" << '\n';
+                std::cout << "--------------------------------------------------------\n";
+
+                for (const auto& waste : wasteRecords)
+                {
+                    std::cout << std::setw(15) << std::left << waste.type
+                              << std::setw(10) << waste.quantity
+                              << std::setw(20) << waste.location
+                              << std::setw(15) << waste.date
+                              << std::setw(15) << waste.condition << '\n';
+                }
+                std::cout << "--------------------------------------------------------\n";
+                break;
+            }
+
+            case 5:
+                // Exit the display records loop
+                continueDisplaying = false;
+                break;
+
+            default:
+                std::cout << "Invalid choice. Please try again.\n";
+        }
+    }
+}
+
+//Using linear search algorithm
+// Function to search for waste by type with enhancements
+void searchWasteByType()
+{
+    if (wasteRecords.empty())
+    {
+        std::cout << "No waste records available for searching!\n";
+        return;
+    }
+
+    std::string searchType;
+    char searchOption;
+
+    // Prompt user for the type of search
+    std::cout << "Enter the type of waste to search for: ";
+    std::cin.ignore();  // To ignore any extra newline characters
+    std::getline(std::cin, searchType);
+
+    // Ask the user if they want a case-insensitive search
+    std::cout << "Would you like to perform a case-insensitive search? (y/n): ";
+    std::cin >> searchOption;
+
+    bool found = false;
+    std::cout << "\nSearch Results:\n";
+    std::cout << "--------------------------------------------\n";
+
+    // Perform search with case-insensitive option if selected
+    for (const auto& waste : wasteRecords)
+    {
+        bool match = false;
+
+        // Case-insensitive comparison if selected by user
+        if (searchOption == 'y' || searchOption == 'Y')
+        {
+            std::string wasteTypeLower = waste.type;
+            std::transform(wasteTypeLower.begin(), wasteTypeLower.end(), wasteTypeLower.begin(), ::tolower);
+            std::string searchTypeLower = searchType;
+            std::transform(searchTypeLower.begin(), searchTypeLower.end(), searchTypeLower.begin(), ::tolower);
+
+            match = (wasteTypeLower == searchTypeLower);
+        }
+         else
+        {
+            match = (waste.type == searchType);
+        }
+
+        // If there's a match, display the waste record
+        if (match)
+        {
+            std::cout << "Type: " << waste.type
+                      << ", Quantity: " << waste.quantity
+                      << ", Location: " << waste.location
+                      << ", Date: " << waste.date
+                      << ", Condition: " << waste.condition << '\n';
+            found = true;
+        }
+    }
+
+    // If no records were found
+    if (!found)
+    {
+        std::cout << "No records found for waste type: " << searchType << '\n';
+    }
+
+    std::cout << "--------------------------------------------\n";
+}
+
+
+// Function to sort waste records by quantity
+void sortWasteRecords()
+{
+    if (wasteRecords.empty())
+    {
+        std::cout << "No waste records available for sorting!\n";
+        return;
+    }
+
+    int choice;
+    std::cout << "\nSelect the sorting order:\n";
+    std::cout << "1. Sort by Quantity (Descending)\n";
+    std::cout << "2. Sort by Quantity (Ascending)\n";
+    std::cout << "3. Sort by Type (Alphabetical)\n";
+    std::cout << "4. Sort by Location (Alphabetical)\n";
+    std::cout << "Enter your choice (1-4): ";
+    std::cin >> choice;
+
+    switch (choice)
+    {
+        case 1:
+            std::cout << "Sorting waste records by quantity (Descending)...\n";
+            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
+                return a.quantity > b.quantity;  // Sort in descending order
+            });
+            break;
+        case 2:
+            std::cout << "Sorting waste records by quantity (Ascending)...\n";
+            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
+                return a.quantity < b.quantity;  // Sort in ascending order
+            });
+            break;
+        case 3:
+            std::cout << "Sorting waste records by type (Alphabetical)...\n";
+            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
+                return a.type < b.type;  // Sort alphabetically by type
+            });
+            break;
+        case 4:
+            std::cout << "Sorting waste records by location (Alphabetical)...\n";
+            std::sort(wasteRecords.begin(), wasteRecords.end(), [](const Wastes& a, const Wastes& b) {
+                return a.location < b.location;  // Sort alphabetically by location
+            });
+            break;
+        default:
+            std::cout << "Invalid choice. No sorting applied.\n";
+            return;
+    }
+
+    std::cout << "Records sorted successfully!\n";
+    displayWasteRecords();  // Display the sorted records after sorting
+}
+
+// Function to evaluate composting feasibility for organic waste
+void evaluateWasteCompostingFeasibility()
+{
+    int organicWaste = 0;
+
+    for (const auto& waste : wasteRecords)
+    {
+        if (waste.type == "organic")
+        {
+            organicWaste += waste.quantity;
+        }
+    }
+
+    if (organicWaste > 100)
+    {
+        std::cout << "Composting is feasible with " << organicWaste << " kg of organic waste.\n";
+    }
+    else
+    {
+        std::cout << "Insufficient organic waste for composting.\n";
+    }
+}
+
+// Function to calculate statistics on the waste data
+void calculateStatistics()
+{
+    if (wasteRecords.empty())
+    {
+        std::cout << "No records to calculate statistics!\n";
+        return;
+    }
+
+    // Initializing variables to calculate statistics
+    int totalQuantity = 0;
+    int totalTypes = 0;
+    int highestQuantity = std::numeric_limits<int>::min();
+    int lowestQuantity = std::numeric_limits<int>::max();
+    std::string highestType, lowestType;
+    std::map<std::string, int> typeCounts;
+    std::map<std::string, int> locationCounts;
+
+    // Loop through the records and calculate statistics
+    for (const auto& waste : wasteRecords)
+    {
+        totalQuantity += waste.quantity;
+        typeCounts[waste.type] += waste.quantity;
+        locationCounts[waste.location] += waste.quantity;
+
+        if (waste.quantity > highestQuantity)
+        {
+            highestQuantity = waste.quantity;
+            highestType = waste.type;
+        }
+
+        if (waste.quantity < lowestQuantity)
+        {
+            lowestQuantity = waste.quantity;
+            lowestType = waste.type;
+        }
+    }
+
+    // Calculating average quantity
+    double averageQuantity = static_cast<double>(totalQuantity) / wasteRecords.size();
+
+    std::cout << "\nWaste Statistics:\n";
+    std::cout << "--------------------------------------------\n";
+    std::cout << "Total Waste Quantity: " << totalQuantity << " kg\n";
+    std::cout << "Average Waste Quantity: " << averageQuantity << " kg\n";
+
+    // Displaying waste quantities by type
+    std::cout << "Waste Quantities by Type:\n";
+    for (const auto& typeCount : typeCounts)
+    {
+        std::cout << "Type: " << typeCount.first << ", Quantity: " << typeCount.second << " kg\n";
+    }
+
+    // Displaying waste quantities by location
+    std::cout << "\nWaste Quantities by Location:\n";
+    for (const auto& locationCount : locationCounts)
+    {
+        std::cout << "Location: " << locationCount.first << ", Quantity: " << locationCount.second << " kg\n";
+    }
+
+    // Displaying waste type with the highest quantity
+    std::cout << "\nType with the Highest Quantity:\n";
+    std::cout << "Type: " << highestType << ", Quantity: " << highestQuantity << " kg\n";
+
+    // Displaying waste type with the lowest quantity
+    std::cout << "\nType with the Lowest Quantity:\n";
+    std::cout << "Type: " << lowestType << ", Quantity: " << lowestQuantity << " kg\n";
+
+    std::cout << "--------------------------------------------\n";
+}
+
+// Function to implement waste trading between regions
+void implementWasteTrading1()
+ {
+    std::map<std::string, int> regionWaste = {
+        {"Region 1", 500},
+        {"Region 2", 700},
+        {"Region 3", 300}
+    };
+
+    std::cout << "Waste Trading Opportunities:\n";
+    for (const auto& region : regionWaste)
+    {
+        std::cout << region.first << " has " << region.second << " kg of waste available for trading.\n";
+    }
+}
+
+
+// Function to send waste to a factory
+
+#include <algorithm>  // For std::transform
+#include <cctype>     // For std::tolower, std::toupper
+
+//Using linear search algorithm
+// Function to send a given quantity of waste to a factory without console input
+// Returns the remaining quantity of that waste type, or -1 if not enough waste is available
+int sendWasteToFactory(std::string wasteType, int quantityToSend, const std::string& factoryName, const std::string& factoryLocation)
+{
+    // Convert the input to lowercase to make it case insensitive
+    std::transform(wasteType.begin(), wasteType.end(), wasteType.begin(), [](unsigned char c){ return std::tolower(c); });
+
+    // Calculate the total available quantity for the specified waste type
+    int totalQuantity = 0;
+    for (const auto& waste : wasteRecords)
+    {
+        std::string recordType = waste.type;
+        std::transform(recordType.begin(), recordType.end(), recordType.begin(), [](unsigned char c){ return std::tolower(c); });
+
+        if (recordType == wasteType)
+        {
+            totalQuantity += waste.quantity;
+        }
+    }
+
+    if (quantityToSend <= 0 || quantityToSend > totalQuantity)
+    {
+        std::cout << "Invalid quantity! Only " << totalQuantity << " kg of '" << wasteType << "' is available.\n";
+        return -1;
+    }
+
+    // Deduct the quantity from waste records and manage remaining quantities
+    int remainingToSend = quantityToSend;  // Track remaining quantity to be deducted
+    for (auto& waste : wasteRecords)
+    {
+        std::string recordType = waste.type;
+        std::transform(recordType.begin(), recordType.end(), recordType.begin(), [](unsigned char c){ return std::tolower(c); });
+
+        if (recordType == wasteType && remainingToSend > 0)
+        {
+            // If the remaining quantity to send is greater than or equal to the waste quantity in this record
+            if (remainingToSend >= waste.quantity)
+            {
+                remainingToSend -= waste.quantity;
+                waste.quantity = 0;  // This waste record is exhausted
+            }
+            else
+            {
+                waste.quantity -= remainingToSend;
+                remainingToSend = 0;  // All required quantity is deducted
+            }
+        }
+    }
+
+    // Add the transaction record to the factory records
+    factoryRecords.push_back({wasteType, quantityToSend, factoryName, factoryLocation});
+
+    // Confirmation message
+    std::cout << "Successfully sent " << quantityToSend << " kg of '" << wasteType << "' to " << factoryName
+              << " located at " << factoryLocation << ".\n";
+
+    // Display remaining quantity of the specified waste type
+    int remainingQuantity = totalQuantity - quantityToSend;
+    std::cout << "Remaining quantity of '" << wasteType << "': " << remainingQuantity << " kg.\n";
+
+    return remainingQuantity;
+}
+
+// Function to send waste to a factory
+void sendWasteToFactory()
+{
+    // Check if there are any waste records to send
+    if (wasteRecords.empty())
+    {
+        std::cout << "No waste records available to send to the factory!\n";
+        return;
+    }
+
+    // Get the type of waste the user wants to send (case insensitive)
+    std::string wasteType;
+    std::cout << "Enter the type of waste to send to the factory: ";
+    std::cin.ignore();  // Clear any leftover newline character
+    std::getline(std::cin, wasteType);
+
+    // Convert the input to lowercase to make it case insensitive
+    std::transform(wasteType.begin(), wasteType.end(), wasteType.begin(), [](unsigned char c){ return std::tolower(c); });
+
+    // Calculate the total available quantity for the specified waste type
+    int totalQuantity = 0;
+    for (const auto& waste : wasteRecords)
+    {
+        // Convert waste type to lowercase for comparison
+        std::string recordType = waste.type;
+        std::transform(recordType.begin(), recordType.end(), recordType.begin(), [](unsigned char c){ return std::tolower(c); });
+
+        if (recordType == wasteType)
+        {
+            totalQuantity += waste.quantity;
+        }
+    }
+
+    // If no records of the specified waste type exist
+    if (totalQuantity == 0)
+    {
+        std::cout << "No waste of type '" << wasteType << "' available for sending.\n";
+        return;
+    }
+
+    // Display the total available quantity of the specified waste type
+    std::cout << "Total available quantity of '" << wasteType << "': " << totalQuantity << " kg.\n";
+
+    // Get the quantity to be sent to the factory
+    int quantityToSend;
+    do
+    {
+        std::cout << "Enter the quantity to send to the factory (between 1 and " << totalQuantity << "): ";
+        std::cin >> quantityToSend;
+        if (quantityToSend <= 0 || quantityToSend > totalQuantity)
+        {
+            std::cout << "Invalid quantity! Please try again.\n";
+        }
+    } while (quantityToSend <= 0 || quantityToSend > totalQuantity);
+
+    // Get factory details
+    std::string factoryName, factoryLocation;
+    std::cin.ignore();  // Clear the input buffer
+    std::cout << "Enter the factory name: ";
+    std::getline(std::cin, factoryName);
+
+    std::cout << "Enter the factory location: ";
+    std::getline(std::cin, factoryLocation);
+
+    // Deduct the quantity and record the transaction
+    sendWasteToFactory(wasteType, quantityToSend, factoryName, factoryLocation);
+
+    // Ask if the user wants to view the updated waste records
+    char viewChoice;
+    std::cout << "Do you want to view the updated waste records? (y/n): ";
+    std::cin >> viewChoice;
+
+    if (viewChoice == 'y' || viewChoice == 'Y')
+    {
+        displayWasteRecords();  // Display the updated records
+    }
+
+    // Ask if the user wants to send more waste to the factory
+    char continueChoice;
+    std::cout << "Do you want to send more waste to a factory? (y/n): ";
+    std::cin >> continueChoice;
+
+    if (continueChoice == 'y' || continueChoice == 'Y')
+    {
+        sendWasteToFactory();  // Recursively call the function to send more waste
+    }
+    else
+    {
+        std::cout << "Returning to the main menu.\n";
+    }
+}
+
+
+
+
+
+// Function to view factory records
+#include <iomanip> // For formatting table display
+
+// Function to display all factory records
+void displayFactoryRecords()
+{
+    if (factoryRecords.empty())
+    {
+        std::cout << "No factory records to display!\n";
+        return;
+    }
+
+    std::cout << "\nAll Factory Records:\n";
+    std::cout << "--------------------------------------------\n";
+    for (const auto& record : factoryRecords)
+    {
+        std::cout << "Type: " << record.wasteType
+                  << ", Quantity: " << record.totalQuantity
+                  << ", Factory: " << record.factoryName
+                  << ", Location: " << record.factoryLocation << '\n';
+    }
+    std::cout << "--------------------------------------------\n";
+}
+
+// Function to display factory records by waste type
+void displayFactoryRecordsByType(const std::string& wasteType)
+ {
+    bool found = false;
+
+    std::cout << "\nFactory Records for Waste Type: " << wasteType << "\n";
+    std::cout << "--------------------------------------------\n";
+    for (const auto& record : factoryRecords) {
+        if (record.wasteType == wasteType) {
+            std::cout << "Type: " << record.wasteType
+                      << ", Quantity: " << record.totalQuantity
+                      << ", Factory: " << record.factoryName
+                      << ", Location: " << record.factoryLocation << '\n';
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        std::cout << "No records found for waste type: " << wasteType << '\n';
+    }
+    std::cout << "--------------------------------------------\n";
+}
+
+// Function to sort factory records by quantity
+void sortFactoryRecordsByQuantity()
+ {
+    std::sort(factoryRecords.begin(), factoryRecords.end(), [](const FactoryRecord& a, const FactoryRecord& b) {
+        return a.totalQuantity > b.totalQuantity;
+    });
+    std::cout << "Factory records sorted by quantity!\n";
+}
+
+// Function to sort factory records by factory name
+void sortFactoryRecordsByName()
+ {
+    std::sort(factoryRecords.begin(), factoryRecords.end(), [](const FactoryRecord& a, const FactoryRecord& b) {
+        return a.factoryName < b.factoryName;
+    });
+    std::cout << "Factory records sorted by factory name!\n";
+}
+
+// Function to sort factory records by location
+void sortFactoryRecordsByLocation()
+ {
+    std::sort(factoryRecords.begin(), factoryRecords.end(), [](const FactoryRecord& a, const FactoryRecord& b) {
+        return a.factoryLocation < b.factoryLocation;
+    });
+    std::cout << "Factory records sorted by location!\n";
+}
+
+// Function to display factory records in table format
+void displayFactoryRecordsInTable()
+{
+    if (factoryRecords.empty())
+    {
+        std::cout << "No factory records to display!\n";
+        return;
+    }
+
+    std::cout << "\nFactory Records (Table Format):\n";
+    std::cout << std::left << std::setw(15) << "Waste Type"
+              << std::setw(10) << "Quantity"
+              << std::setw(20) << "Factory Name"
+              << std::setw(15) << "Location" << '\n';
+    std::cout << std::string(60, '-') << '\n';
+
+    for (const auto& record : factoryRecords)
+    {
+        std::cout << std::left << std::setw(15) << record.wasteType
+                  << std::setw(10) << record.totalQuantity
+                  << std::setw(20) << record.factoryName
+                  << std::setw(15) << record.factoryLocation << '\n';
+    }
+    std::cout << std::string(60, '-') << '\n';
+}
+
+// Function to export factory records to a CSV file
+void exportFactoryRecordsToCSV()
+ {
+    std::string fileName;
+    std::cout << "Enter the file name to save factory records (e.g., factory_records.csv): ";
+    std::cin.ignore(); // Ignore leftover newline
+    std::getline(std::cin, fileName);
+
+    std::ofstream outFile(fileName);
+    if (!outFile.is_open())
+    {
+        std::cout << "Failed to open file for writing. Please try again.\n";
+        return;
+    }
+
+    // Write CSV headers
+    outFile << "Waste Type,Quantity,Factory Name,Factory Location\n";
+
+    // Write each factory record to the CSV file
+    for (const auto& record : factoryRecords)
+    {
+        outFile << record.wasteType << ","
+                << record.totalQuantity << ","
+                << record.factoryName << ","
+                << record.factoryLocation << "\n";
+    }
+
+    outFile.close();
+    std::cout << "Factory records successfully exported to '" << fileName << "'.\n";
+}
+void saveToCSV(const std::string& filePath)
+ {
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Could not open file for writing at " << filePath << '\n';
+        return;
+    }
+
+    // Write the header for the CSV file
+    file << "Type,Quantity,Location,Date,Condition\n";
+
+    // Write waste data records to the file
+    for (const auto& waste : wasteRecords)
+    {
+        file << waste.type << ',' << waste.quantity << ',' << waste.location
+             << ',' << waste.date << ',' << waste.condition << '\n';
+    }
+
+    file.close();
+    std::cout << "Data saved successfully to the CSV file!\n";
+}
+
+// Complete function to view factory records with menu options
+void viewFactoryRecords()
+{
+    if (factoryRecords.empty())
+    {
+        std::cout << "No factory records to display!\n";
+        return;
+    }
+
+    int choice;
+    do
+        {
+        std::cout << "\n=== View Factory Records Menu ===\n";
+        std::cout << "1. View All Factory Records\n";
+        std::cout << "2. View Factory Records by Waste Type\n";
+        std::cout << "3. Sort Factory Records by Quantity\n";
+        std::cout << "4. Sort Factory Records by Factory Name\n";
+        std::cout << "5. Sort Factory Records by Location\n";
+        std::cout << "6. Display Factory Records in Table Format\n";
+        std::cout << "7. Export Factory Records to CSV\n";
+        std::cout << "8. Exit\n";
+        std::cout << "Enter your choice (1-8): ";
+        std::cin >> choice;
+
+        switch (choice) {
+            case 1:
+                displayFactoryRecords();
+                break;
+
+            case 2: {
+                std::string wasteType;
+                std::cout << "Enter the waste type to search for: ";
+                std::cin.ignore(); // Ignore leftover newline
+                std::getline(std::cin, wasteType);
+                displayFactoryRecordsByType(wasteType);
+                break;
+            }
+
+            case 3:
+                sortFactoryRecordsByQuantity();
+                break;
+
+            case 4:
+                sortFactoryRecordsByName();
+                break;
+
+            case 5:
+                sortFactoryRecordsByLocation();
+                break;
+
+            case 6:
+                displayFactoryRecordsInTable();
+                break;
+
+            case 7:
+                exportFactoryRecordsToCSV();
+                break;
+
+            case 8:
+                std::cout << "Exiting the view menu.\n";
+                break;
+
+            default:
+                std::cout << "Invalid choice. Please try again.\n";
+        }
+    } while (choice != 8);
+}
+
+
+// Function to update an existing waste record
+void updateWasteRecord()
+ {
+    // Prompt user to enter the type of waste they want to update
+    std::string searchType;
+    std::cout << "Enter the type of waste you want to update: ";
+    // To clear the input buffer
+    std::cin.ignore();
+    // Read the waste type to update
+    std::getline(std::cin, searchType);
+
+    // Flag to check if waste record is found
+    bool found = false;
+
+    // Loop through waste records to find the matching type
+    for (auto& waste : wasteRecords)
+     {
+        if (waste.type == searchType)
+        {
+            found = true;  // Mark as found
+            std::cout << "Updating record for waste type: " << waste.type << "\n";
+
+            // Ask user to enter new details for the waste record
+            std::cout << "Enter new quantity: ";
+             // Update quantity
+            std::cin >> waste.quantity;
+            while (waste.quantity < 0)
+            {
+                // Validate positive quantity
+                std::cout << "Quantity must be non-negative. Please enter a valid quantity: ";
+                std::cin >> waste.quantity;
+            }
+
+            // Get new location from the user
+            std::cout << "Enter new location: ";
+            // Ignore any extra newline characters
+            std::cin.ignore();
+             // Read the new location
+            std::getline(std::cin, waste.location);
+
+            // Get new condition from the user
+            std::cout << "Enter new condition (e.g., clean, contaminated): ";
+            // Read the new condition
+            std::getline(std::cin, waste.condition);
+
+            // Display the updated record to the user
+            std::cout << "Record updated successfully!\n";
+            std::cout << "Updated waste record:\n";
+            std::cout << "Type: " << waste.type
+                      << ", Quantity: " << waste.quantity
+                      << ", Location: " << waste.location
+                      << ", Date: " << waste.date
+                      << ", Condition: " << waste.condition << "\n";
+                        // Exit loop after updating the first match
+            break;
+        }
+    }
+
+    // If no matching waste type was found
+    if (!found)
+    {
+        std::cout << "No record found with waste type: " << searchType << "\n";
+    }
+}
+
+
+// Function to calculate potential energy from waste
+void calculateEnergyFromWaste1()
+ {
+    std::map<std::string, int> wasteEnergyPotential = {
+        {"plastic", 1000},
+        {"organic", 800},
+        {"paper", 500},
+        {"metal", 200}
+    };
+
+    int totalEnergy = 0;
+
+    for (const auto& waste : wasteEnergyPotential)
+    {
+        totalEnergy += waste.second;
+    }
+
+    std::cout << "Total Potential Energy from Waste: " << totalEnergy << " MJ\n";
+}
+
+
+// Function to delete a waste record
+void deleteWasteRecord()
+{
+    // Prompt the user to enter the type of waste to delete
+    std::string searchType;
+    std::cout << "Enter the type of waste you want to delete: ";
+    // Clear any extra input buffer
+    std::cin.ignore();
+    // Read the waste type
+    std::getline(std::cin, searchType);
+
+    // Check if there are any records available before trying to delete
+    if (wasteRecords.empty())
+    {
+        std::cout << "No records available to delete.\n";
+        return;
+    }
+
+    // Search for the waste record using std::remove_if to find matching types
+    auto it = std::remove_if(wasteRecords.begin(), wasteRecords.end(),
+        [&searchType](const Wastes& waste) { return waste.type == searchType; });
+
+    // If a matching waste type is found, erase the record
+    if (it != wasteRecords.end())
+    {
+        // Erase the record from the vector using the iterator returned by std::remove_if
+        wasteRecords.erase(it, wasteRecords.end());
+
+        // Provide user feedback on successful deletion
+        std::cout << "Record for waste type: " << searchType << " deleted successfully!\n";
+
+        // Display the remaining waste records
+        std::cout << "Updated waste records:\n";
+
+        for (const auto& waste : wasteRecords)
+        {
+            std::cout << "Type: " << waste.type
+                      << ", Quantity: " << waste.quantity
+                      << ", Location: " << waste.location
+                      << ", Date: " << waste.date
+                      << ", Condition: " << waste.condition << "\n";
+        }
+    }
+
+     else
+    {
+        // If no matching waste record was found, notify the user
+        std::cout << "No record found with waste type: " << searchType << "\n";
+    }
+
+    // Optionally, you can implement a confirmation prompt to ask the user if they want to delete multiple records or go back
+    char confirmDeletion;
+    std::cout << "Do you want to delete another waste record? (Y/N): ";
+    std::cin >> confirmDeletion;
+
+    if (confirmDeletion == 'Y' || confirmDeletion == 'y')
+    {
+        // Recursive call to allow the user to delete more records if desired
+        deleteWasteRecord();
+    }
+
+    else
+    {
+        // Optionally, return to the main menu or end the operation
+        std::cout << "Returning to the main menu.\n";
+    }
+}
+
+// Function to add a new waste record
+// Function to add a new waste record
+void addNewWasteRecord()
+ {
+    // Declare a new waste record object to be added
+    Wastes newWaste;
+
+    // Ask the user to enter waste type
+    std::cout << "Enter waste type: ";
+     // Clear any extra input buffer
+    std::cin.ignore();
+     // Read the type of waste
+    std::getline(std::cin, newWaste.type);
+
+    // Validate that waste type is not empty
+    if (newWaste.type.empty())
+    {
+        std::cout << "Error: Waste type cannot be empty.\n";
+        return;  // Exit if waste type is empty
+    }
+
+    // Ask the user to enter quantity
+    std::cout << "Enter quantity (in kg): ";
+    std::cin >> newWaste.quantity;
+
+    // Validate that quantity is a positive number
+    if (newWaste.quantity <= 0)
+    {
+        std::cout << "Error: Quantity must be greater than zero.\n";
+        // Exit if the quantity is invalid
+        return;
+    }
+
+    // Ask the user to enter location
+    std::cout << "Enter location: ";
+
+     // Clear the input buffer
+    std::cin.ignore();
+    // Read the location of the waste
+    std::getline(std::cin, newWaste.location);
+
+    // Validate that location is not empty
+
+    if (newWaste.location.empty())
+    {
+        std::cout << "Error: Location cannot be empty.\n";
+         // Exit if location is empty
+        return;
+    }
+
+    // Ask the user to enter the date of the waste record
+    std::cout << "Enter date (YYYY-MM-DD): ";
+    std::getline(std::cin, newWaste.date);  // Read the date
+
+    // Validate that the date is a real date in the format YYYY-MM-DD
+    int dayNumber;
+    if (!parseDate(newWaste.date, DateFormat::YearMonthDay, dayNumber))
+    {
+        std::cout << "Error: Date must be a valid date in the format YYYY-MM-DD.\n";
+    // Exit if the date format is incorrect
+        return;
+    }
+
+    // Ask the user to enter the condition of the waste
+    std::cout << "Enter condition (e.g.,Recyclable,Non-Recyclable,Compostable): ";
+
+    // Read the condition
+    std::getline(std::cin, newWaste.condition);
+    // Validate that condition is not empty
+    if (newWaste.condition.empty())
+    {
+        std::cout << "Error: Condition cannot be empty.\n";
+        // Exit if condition is empty
+        return;
+    }
+
+    // Add the new waste record to the vector of records
+    wasteRecords.push_back(newWaste);
+
+    // Provide feedback to the user about the success of the operation
+    std::cout << "New waste record added successfully!\n";
+
+    // Optional: Ask the user if they want to add another record
+    char confirmAdd;
+
+    std::cout << "Do you want to add another waste record? (Y/N): ";
+    std::cin >> confirmAdd;
+
+    if (confirmAdd == 'Y' || confirmAdd == 'y')
+    {
+        // Recursively call the function to allow adding another record
+        addNewWasteRecord();
+    }
+
+    else
+    {
+        // Optionally, return to the main menu or end the operation
+        std::cout << "Returning to the main menu.\n";
+    }
+
+    // Optionally, print the updated list of waste records
+    std::cout << "Updated waste records:\n";
+    for (const auto& waste : wasteRecords)
+    {
+        std::cout << "Type: " << waste.type
+                  << ", Quantity: " << waste.quantity
+                  << ", Location: " << waste.location
+                  << ", Date: " << waste.date
+                  << ", Condition: " << waste.condition << "\n";
+    }
+}
+
+
+// Function to validate integer input
+
+void validateInput(int& input, const std::string& prompt)
+ {
+    std::cout << prompt;
+
+    while (!(std::cin >> input))
+    {
+        // Clear error flag
+        std::cin.clear();
+        // Ignore incorrect input
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "Invalid input. Please enter a valid integer: ";
+    }
+}
+
+
+// Function to validate string input
+void validateInput(std::string& input, const std::string& prompt)
+{
+    std::cout << prompt;
+    std::getline(std::cin, input);
+
+    while (input.empty())
+    {
+        std::cout << "Invalid input. Please enter a valid string: ";
+        std::getline(std::cin, input);
+    }
+}
+
+// Function to handle case-sensitive and partial matching of waste types
+#include <iostream>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+using namespace std;
+
+void selectFactoryForWasteType()
+{
+    // List of valid waste types
+    vector<string> validWasteTypes = {"plastic", "E-waste", "organic", "paper", "glass", "metal"};
+
+    string wasteType;
+    cout << "Enter the type of waste to send to the factory: ";
+    cin.ignore();  // Ignore extra newline characters
+    getline(cin, wasteType);
+
+    // Convert wasteType to lowercase for partial matching (if needed)
+    string lowerWasteType = wasteType;
+    transform(lowerWasteType.begin(), lowerWasteType.end(), lowerWasteType.begin(), ::tolower);
+
+    // Find relevant waste types based on partial match
+    vector<string> matchingTypes;
+    for (const auto& validType : validWasteTypes)
+    {
+        // Check if the input wasteType partially matches any of the valid waste types
+        if (validType.find(lowerWasteType) != string::npos)
+        {
+            matchingTypes.push_back(validType);
+        }
+    }
+
+    if (matchingTypes.empty())
+    {
+        cout << "No matching waste types found for '" << wasteType << "'\n";
+        return;
+    }
+
+    // Show matching waste types
+    cout << "Matching waste types:\n";
+    for (const auto& match : matchingTypes)
+    {
+        cout << match << "\n";
+    }
+
+    // Now you can recommend factories for the selected waste type
+    cout << "Finding recommended factories for waste type: " << wasteType << "\n";
+
+    // Mapping waste type to factories
+    map<string, vector<string>> wasteFactories =
+    {
+        {"plastic", {"Plastic Renewal Corp, Shahapur", "Eco Green Plastics, Udyambag", "Recycle Plastic Industries, Nanawadi", "CleanTech Plastics, Angol", "Future Plastics Ltd, Tilakwadi"}},
+        {"E-waste", {"Digital Waste Hub, Angol", "EcoTech Recycling, Nanawadi", "Green Electronics, Shahapur", "Smart E-Recycle Center, Udyambag", "Future Tech Renewals, Tilakwadi"}},
+        {"glass", {"Green Glass Recycling, Shahapur","Belgaum Glassworks, Camp", "Shree Glass Recycling, Tilakwadi","Clear Glass Recyclers, Udyambag"}},
+        {"metal", {"Belgaum Metal Works, Angol","MetalCraft Recycling, Tilakwadi","Fusion Metals, Udyambag","Belgaum Iron & Steel, Shahapur","Precision Metal Recyclers, Camp"}},
+        {"organic", {"Belgaum Compost Facility, Sambra","Green Earth Organic Recycling, Tilakwadi","EcoCompost, Udyambag","Bio-Waste Solutions, Nanawadi","GreenTech Organics, Shahapur"}},
+        {"paper", {"Belgaum Paper Mills, Tilakwadi","Green Paper Recycling, Udyambag","Eco Paper Recycling Ltd, Shahapur","Belgaum Waste Paper Recycling, Angol","PaperCycle, Nanawadi"}}
+    };
+
+    // Find the matching factories based on the first match
+    for (const auto& matchingType : matchingTypes)
+    {
+        if (wasteFactories.find(matchingType) != wasteFactories.end())
+        {
+            cout << "Recommended factories for waste type '" << matchingType << "':\n";
+            for (const auto& factory : wasteFactories[matchingType])
+            {
+                cout << factory << "\n";
+            }
+        }
+    }
+}
+
+// Function to display the main menu in a retro game-like style
+void displayMenu()
+{
+    int choice;
+    do {
+        // Print retro-style table with borders and menu options
+        std::cout << "\n";
+        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
+        std::cout << CYAN "|      " BOLD "WASTE MANAGEMENT SYSTEM MENU" RESET CYAN "      |" RESET << "\n";
+        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
+
+        // Menu options with colorful text
+        std::cout << YELLOW "| " RESET "1. " GREEN "View All Waste Records" RESET << "\n";
+        std::cout << YELLOW "| " RESET "2. " GREEN "Search Waste by Type" RESET << "\n";
+        std::cout << YELLOW "| " RESET "3. " GREEN "Sort Waste Records" RESET << "\n";
+        std::cout << YELLOW "| " RESET "4. " GREEN "Calculate Waste Statistics" RESET << "\n";
+        std::cout << YELLOW "| " RESET "5. " GREEN "Save Data to CSV" RESET << "\n";
+        std::cout << YELLOW "| " RESET "6. " GREEN "Add New Waste Record" RESET << "\n";
+        std::cout << YELLOW "| " RESET "7. " GREEN "Update Waste Record" RESET << "\n";
+        std::cout << YELLOW "| " RESET "8. " GREEN "Delete Waste Record" RESET << "\n";
+        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
+        std::cout << YELLOW "| " RESET "9. " GREEN "Select Waste Type for Factory" RESET << "\n"; // New case
+        std::cout << YELLOW "| " RESET "10. " GREEN "Send Waste to Factory" RESET << "\n";
+        std::cout << YELLOW "| " RESET "11. " GREEN "View Factory Records" RESET << "\n";
+        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
+        std::cout << YELLOW "| " RESET "12. " GREEN "Exit" RESET << "\n";
+        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
+
+        // Prompt for user input
+        std::cout << BLUE "Enter your choice (1-12): " RESET;
+        std::cin >> choice;
+
+        // Menu logic
+        switch (choice)
+        {
+            // Waste Records Management
+            case 1:
+                displayWasteRecords();
+                break;
+            case 2:
+                searchWasteByType();
+                break;
+            case 3:
+                sortWasteRecords();
+                break;
+            case 4:
+                calculateStatistics();
+                break;
+            case 5:
+                saveToCSV("updated_waste_data.csv");
+                break;
+
+            // Waste Record Modification
+            case 6:
+                addNewWasteRecord();
+                break;
+            case 7:
+                updateWasteRecord();
+                break;
+            case 8:
+                deleteWasteRecord();
+                break;
+
+            // Factory and Waste Processing
+            case 9:
+                // New case: Select waste type before sending to the factory
+                selectFactoryForWasteType();
+                break;
+            case 10:
+                sendWasteToFactory();
+                break;
+            case 11:
+                viewFactoryRecords();
+                break;
+
+            // Exit the program
+            case 12:
+                std::cout << RED "Exiting... Goodbye!" RESET "\n";
+                break;
+
+            // Handle invalid choices
+            default:
+                std::cout << RED "Invalid choice. Please try again." RESET "\n";
+                break;
+        }
+    } while (choice != 12);
+}
+
+
+// Main function to start the program
+
+int wastetofactory()
+{
+    // Ensure the file path is correctly formatted for Windows
+    std::string filePath = "C:\\MY CODES @KLES\\wastemagdata.csv";
+
+    // Load existing data from the file
+    loadCSV(filePath);
+
+    // Display the menu for user interactions
+    displayMenu();
+
+    return 0;
+}
+
+
+// MappedFile: the platform headers above make these definitions possible
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize))
+    {
+        length = static_cast<std::size_t>(fileSize.QuadPart);
+        opened = true;
+        if (length > 0)
+        {
+            // The view keeps the mapping alive once both handles are closed
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                bytes = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+            opened = bytes != nullptr;
+        }
+    }
+    CloseHandle(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if (bytes != nullptr)
+        UnmapViewOfFile(bytes);
+}
+
+#else
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1)
+        return;
+
+    struct stat info;
+    if (fstat(fd, &info) == 0)
+    {
+        length = static_cast<std::size_t>(info.st_size);
+        opened = true;
+        if (length > 0)
+        {
+            void* view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            opened = view != MAP_FAILED;
+            bytes = opened ? static_cast<const char*>(view) : nullptr;
+        }
+    }
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (bytes != nullptr)
+        munmap(const_cast<char*>(bytes), length);
+}
+
+#endif
+
+
+// Batch Mode
+//
+// Runs the four modules without the interactive menus. Each line of the job
+// stream is one command; blank lines and lines starting with '#' are ignored.
+// Names containing spaces must be quoted, e.g. waste "Shivaji Nagar" 1500
+//
+//   quiet on|off                                 suppress per-operation output
+//   fleet default                                default vehicles, drivers and wastes
+//   vehicle <model> <capacity> <mileage>
+//   driver <name> <age> <address>
+//   waste <area> <quantity>
+//   allot <wasteNumber> <dd/mm/yyyy>             wasteNumber starts at 1
+//   allot-all <dd/mm/yyyy>                       every pending waste pile in one pass
+//   allot-tours <dd/mm/yyyy> [starts]            multi-stop collection tours, default 1 start, at most 1024
+//   release-vehicle <vehicleNumber>              vehicle is back from its trip
+//   release-driver <driverNumber>
+//   simulate <first-fit|best-fit> [interval]     pending piles arriving every interval minutes
+//                                                (default 10) from the dispatch time
+//   simulate-random <piles> [seed]               random day under both policies
+//   fleet-sweep <piles> <maxEach> <driversFrom> <driversTo> [model ...]
+//                                                every mix of 0 - maxEach of each model (default:
+//                                                every registered model) on one random day, in parallel
+//   shortest <areaNumber> [algorithm]            route from Kanabargi, areaNumber starts at 1
+//                                                algorithm: dijkstra|early-exit|bidirectional|astar|ch
+//   longest <areaNumber>
+//   collected [from to]                          waste collection details by date, dd/mm/yyyy
+//   history <vehicleModel> [from to]             one vehicle's trips, oldest first
+//   fuel-report [vehicles|drivers|areas|days]    fuel and CO2 totals, default vehicles
+//   fuel-between <from> <to>                     fuel and CO2 over a date range, dd/mm/yyyy
+//   fuel-export <file>                           every fuel and CO2 total as CSV
+//   route-cache [capacity]                       route cache statistics, optionally resizing it
+//   log-open <file>                              load an allocation log and append to it
+//   log-load <file>                              replace allocations with a log's contents
+//   log-compact                                  rewrite the open log with current allocations
+//   network-load <file>                          road network (text edge list or binary)
+//   network-save <file>                          binary road network
+//   coordinates <areaNumber> <lat> <lon>         area position in degrees, used by astar
+//   route-algorithm <algorithm>                  for networks too large for the all-pairs table
+//   road-close <from> <to>                       areaNumbers; closes every road from -> to
+//   road-open <from> <to> <km>                   adds a one-way road
+//   road-weight <from> <to> <km>
+//   replan [dd/mm/yyyy]                          re-route stored trips (all dates by default)
+//   speed-profile <name> <hh:mm> <kmh> ...       road speed over the day, linear between times
+//   road-profile <from> <to> <name>              areaNumbers, or "road-profile all <name>"
+//   fastest <areaNumber> <hh:mm>                 quickest route from Kanabargi leaving at hh:mm
+//   dispatch-time <hh:mm>                        departure time for allotment ETAs, default 06:00
+//   ch-build                                     contraction hierarchy for the current network
+//   ch-save <file>
+//   ch-load <file>                               must match the current network
+//   bench-area-lookup [maxAreas]                 area name lookup cost, default 100000
+//   bench-longest [maxAreas]                     exact longest route engines, default 18
+//   bench-route [queries]                        areas settled per algorithm, default 100
+//   bench-closure [closures]                     all-pairs repair after road edits, default 20
+//   bench-scenarios [piles]                      scenario runner scaling by thread count, default 40
+//   bench-date [dates]                           date validation cost, default 1000000
+//   area <name> <address> <city>
+//   areas-load <file>                            name,address,city rows; quoted fields may hold commas
+//   bench-csv [rows]                             area file reading throughput, default 1000000
+//   bench-city [areas]                           case-insensitive city filter cost, default 1000000
+//   bench-stats [areas]                          population statistics kernels, default 10000000
+//   population <area> <population>
+//   waste-generation [kgPerPersonPerDay]
+//   waste-csv <file>
+//   waste-record <type> <quantity> <location> <date> <condition>
+//   send <wasteType> <quantity> <factoryName> <factoryLocation>
+//   products default
+//   cart-add <productName> <quantity>
+//   checkout
+#include <chrono>
+
+int runBatch(std::istream& jobs)
+{
+    BelgaumWasteManagement bwm;
+    AreaDatabase database;
+    vector<RecycledProduct> products = defaultRecycledProducts();
+    vector<CartItem> cart;
+
+    // Batch messages always go to the real console, even in quiet mode
+    std::streambuf* consoleBuffer = std::cout.rdbuf();
+    std::ostream report(consoleBuffer);
+
+    int lineNumber = 0;
+    long long operations = 0;
+    int errors = 0;
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::string line;
+    while (std::getline(jobs, line))
+    {
+        lineNumber++;
+
+        std::istringstream args(line);
+        std::string command;
+        if (!(args >> command) || command[0] == '#')
+        {
+            continue;
+        }
+
+        bool ok = true;
+
+        if (command == "quiet")
+        {
+            std::string mode;
+            args >> mode;
+            std::cout.rdbuf(mode == "off" ? consoleBuffer : nullptr);
+            continue;
+        }
+        else if (command == "fleet")
+        {
+            std::string which;
+            ok = (args >> which) && which == "default";
+            if (ok)
+            {
+                loadDefaultFleet(bwm);
+            }
+        }
+        else if (command == "vehicle")
+        {
+            std::string model;
+            int capacity;
+            double mileage;
+            ok = static_cast<bool>(args >> std::quoted(model) >> capacity >> mileage);
+            if (ok)
+            {
+                bwm.addVehicle(Vehicle(model, capacity, mileage));
+            }
+        }
+        else if (command == "driver")
+        {
+            std::string name, address;
+            int age;
+            ok = static_cast<bool>(args >> std::quoted(name) >> age >> std::quoted(address));
+            if (ok)
+            {
+                bwm.addDriver(Driver(name, age, address));
+            }
+        }
+        else if (command == "waste")
+        {
+            std::string area;
+            int quantity;
+            ok = static_cast<bool>(args >> std::quoted(area) >> quantity);
+            if (ok)
+            {
+                bwm.addWaste(Waste(area, quantity));
+            }
+        }
+        else if (command == "allot")
+        {
+            int wasteNumber;
+            std::string date;
+            ok = (args >> wasteNumber >> date) && bwm.isValidDate(date) &&
+                 bwm.allotVehicle(wasteNumber - 1, date);
+        }
+        else if (command == "allot-all")
+        {
+            std::string date;
+            ok = (args >> date) && bwm.isValidDate(date);
+            if (ok)
+            {
+                bwm.allotAllWastes(date);
+            }
+        }
+        else if (command == "allot-tours")
+        {
+            std::string date;
+            int starts = 1;
+            ok = (args >> date) && bwm.isValidDate(date);
+            if (ok)
+            {
+                if (!(args >> starts))
+                {
+                    starts = 1;
+                }
+                ok = starts >= 1 && starts <= BelgaumWasteManagement::TOUR_STARTS_LIMIT;
+                if (ok)
+                {
+                    bwm.allotCollectionTours(date, starts);
+                }
+            }
+        }
+        else if (command == "release-vehicle")
+        {
+            int vehicleNumber;
+            ok = (args >> vehicleNumber) && bwm.releaseVehicle(vehicleNumber - 1);
+        }
+        else if (command == "release-driver")
+        {
+            int driverNumber;
+            ok = (args >> driverNumber) && bwm.releaseDriver(driverNumber - 1);
+        }
+        else if (command == "shortest" || command == "longest")
+        {
+            int areaNumber;
+            ok = (args >> areaNumber) && areaNumber >= 1 && areaNumber <= bwm.getAreaCount();
+            std::string name;
+            RouteAlgorithm algorithm;
+            if (ok && command == "shortest" && (args >> name))
+            {
+                ok = parseRouteAlgorithm(name, algorithm);
+                if (ok)
+                {
+                    bwm.findShortestRouteToDestination(0, areaNumber - 1, algorithm);
+                }
+            }
+            else if (ok && command == "shortest")
+            {
+                bwm.findShortestRouteToDestination(0, areaNumber - 1);
+            }
+            else if (ok)
+            {
+                bwm.findLongestRouteToDestination(0, areaNumber - 1);
+            }
+        }
+        else if (command == "collected")
+        {
+            std::string fromDate, toDate;
+            if (args >> fromDate >> toDate)
+            {
+                ok = bwm.isValidDate(fromDate) && bwm.isValidDate(toDate);
+                if (ok)
+                {
+                    bwm.displayCollectedWasteByDate(fromDate, toDate);
+                }
+            }
+            else
+            {
+                ok = fromDate.empty();
+                if (ok)
+                {
+                    bwm.displayCollectedWasteByDate();
+                }
+            }
+        }
+        else if (command == "history")
+        {
+            std::string model, fromDate, toDate;
+            ok = static_cast<bool>(args >> std::quoted(model));
+            if (ok && (args >> fromDate >> toDate))
+            {
+                ok = bwm.isValidDate(fromDate) && bwm.isValidDate(toDate);
+            }
+            else
+            {
+                ok = ok && fromDate.empty();
+            }
+            if (ok)
+            {
+                bwm.displayVehicleHistory(model, fromDate, toDate);
+            }
+        }
+        else if (command == "network-load")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && bwm.loadRoadNetwork(filename);
+        }
+        else if (command == "network-save")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && bwm.saveRoadNetwork(filename);
+        }
+        else if (command == "fuel-report")
+        {
+            std::string kind = "vehicles";
+            args >> kind;
+            ok = bwm.getFuelLedger().printReport(kind, bwm.getAllocationStrings(), std::cout);
+        }
+        else if (command == "fuel-between")
+        {
+            std::string fromDate, toDate;
+            ok = (args >> fromDate >> toDate) && bwm.isValidDate(fromDate) && bwm.isValidDate(toDate);
+            if (ok)
+            {
+                FuelTotals totals = bwm.getFuelLedger().between(dateToDayNumber(fromDate), dateToDayNumber(toDate));
+                std::cout << fromDate << " - " << toDate << ": " << totals.trips << " trips, " << totals.fuelLiters
+                          << " liters, " << totals.co2Kg << " kg CO2" << std::endl;
+            }
+        }
+        else if (command == "fuel-export")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && bwm.getFuelLedger().exportCsv(filename, bwm.getAllocationStrings());
+        }
+        else if (command == "route-cache")
+        {
+            std::size_t capacity;
+            if (args >> capacity)
+            {
+                ok = capacity > 0;
+                if (ok)
+                {
+                    bwm.setRouteCacheCapacity(capacity);
+                }
+            }
+            const RouteCache& cache = bwm.getRouteCache();
+            long long lookups = cache.getHits() + cache.getMisses();
+            std::cout << "Route cache: " << cache.size() << " of " << cache.getCapacity() << " routes, "
+                      << cache.getHits() << " hits, " << cache.getMisses() << " misses, hit rate "
+                      << (lookups ? 100.0 * cache.getHits() / lookups : 0.0) << "%" << std::endl;
+        }
+        else if (command == "log-open")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && bwm.openAllocationLog(filename);
+        }
+        else if (command == "log-load")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && bwm.loadDataFromFile(filename);
+        }
+        else if (command == "log-compact")
+        {
+            ok = bwm.storeDataInFile();
+        }
+        else if (command == "simulate")
+        {
+            std::string name;
+            AllocationPolicy policy;
+            double interval = 10;
+            ok = (args >> name) && parseAllocationPolicy(name, policy);
+            if (ok)
+            {
+                if (!(args >> interval))
+                {
+                    interval = 10;
+                }
+                printSimulationHeader();
+                printSimulationReport(name, bwm.simulateDay(bwm.pendingWasteArrivals(interval), policy));
+            }
+        }
+        else if (command == "simulate-random")
+        {
+            int piles;
+            unsigned seed = 16;
+            ok = (args >> piles) && piles > 0;
+            if (ok)
+            {
+                if (!(args >> seed))
+                {
+                    seed = 16;
+                }
+                simulateRandomDay(bwm, piles, seed);
+            }
+        }
+        else if (command == "fleet-sweep")
+        {
+            // fleet-sweep <piles> <maxEach> <driversFrom> <driversTo> [model ...]
+            int piles, maxEach, driversFrom, driversTo;
+            ok = (args >> piles >> maxEach >> driversFrom >> driversTo) && piles > 0 && maxEach >= 0 &&
+                 driversFrom >= 0 && driversFrom <= driversTo && bwm.getAreaCount() > 1;
+            std::vector<Vehicle> catalogue = bwm.getVehicleModels(), models;
+            std::string model;
+            while (ok && (args >> std::quoted(model)))
+            {
+                auto found = std::find_if(catalogue.begin(), catalogue.end(),
+                                          [&model](const Vehicle& v) { return v.vehicleModel == model; });
+                ok = found != catalogue.end();
+                if (ok)
+                {
+                    models.push_back(*found);
+                }
+            }
+            ok = ok && !(models.empty() ? catalogue : models).empty();
+            if (ok && fleetMixCount((models.empty() ? catalogue : models).size(), maxEach, driversFrom, driversTo) > FLEET_SWEEP_LIMIT)
+            {
+                std::cerr << "Error: fleet-sweep would simulate more than " << FLEET_SWEEP_LIMIT
+                          << " fleet mixes; lower maxEach, narrow the driver range or name fewer models.\n";
+                ok = false;
+            }
+            if (ok)
+            {
+                runFleetSweep(bwm, models.empty() ? catalogue : models, piles, maxEach, driversFrom, driversTo,
+                              std::max(1u, std::thread::hardware_concurrency()));
+            }
+        }
+        else if (command == "road-close")
+        {
+            int from, to;
+            ok = (args >> from >> to) && bwm.removeRoad(from - 1, to - 1);
+        }
+        else if (command == "road-open" || command == "road-weight")
+        {
+            int from, to, km;
+            ok = static_cast<bool>(args >> from >> to >> km);
+            if (ok && command == "road-open")
+            {
+                ok = bwm.addRoad(from - 1, to - 1, km);
+            }
+            else if (ok)
+            {
+                ok = bwm.setRoadWeight(from - 1, to - 1, km);
+            }
+        }
+        else if (command == "replan")
+        {
+            std::string date;
+            ok = !(args >> date) || bwm.isValidDate(date);
+            if (ok)
+            {
+                bwm.replanRoutes(date);
+            }
+        }
+        else if (command == "speed-profile")
         {
-            matchingTypes.push_back(validType);
+            std::string name, clock;
+            double minute, speed;
+            std::vector<std::pair<double, double>> points;
+            ok = static_cast<bool>(args >> name);
+            while (ok && (args >> clock))
+            {
+                ok = parseClockTime(clock, minute) && (args >> speed);
+                points.push_back({minute, speed});
+            }
+            ok = ok && bwm.setSpeedProfile(name, points);
         }
-    }
-
-    if (matchingTypes.empty())
-    {
-        cout << "No matching waste types found for '" << wasteType << "'\n";
-        return;
-    }
-
-    // Show matching waste types
-    cout << "Matching waste types:\n";
-    for (const auto& match : matchingTypes)
-    {
-        cout << match << "\n";
-    }
-
-    // Now you can recommend factories for the selected waste type
-    cout << "Finding recommended factories for waste type: " << wasteType << "\n";
-
-    // Mapping waste type to factories
-    map<string, vector<string>> wasteFactories =
-    {
-        {"plastic", {"Plastic Renewal Corp, Shahapur", "Eco Green Plastics, Udyambag", "Recycle Plastic Industries, Nanawadi", "CleanTech Plastics, Angol", "Future Plastics Ltd, Tilakwadi"}},
-        {"E-waste", {"Digital Waste Hub, Angol", "EcoTech Recycling, Nanawadi", "Green Electronics, Shahapur", "Smart E-Recycle Center, Udyambag", "Future Tech Renewals, Tilakwadi"}},
-        {"glass", {"Green Glass Recycling, Shahapur","Belgaum Glassworks, Camp", "Shree Glass Recycling, Tilakwadi","Clear Glass Recyclers, Udyambag"}},
-        {"metal", {"Belgaum Metal Works, Angol","MetalCraft Recycling, Tilakwadi","Fusion Metals, Udyambag","Belgaum Iron & Steel, Shahapur","Precision Metal Recyclers, Camp"}},
-        {"organic", {"Belgaum Compost Facility, Sambra","Green Earth Organic Recycling, Tilakwadi","EcoCompost, Udyambag","Bio-Waste Solutions, Nanawadi","GreenTech Organics, Shahapur"}},
-        {"paper", {"Belgaum Paper Mills, Tilakwadi","Green Paper Recycling, Udyambag","Eco Paper Recycling Ltd, Shahapur","Belgaum Waste Paper Recycling, Angol","PaperCycle, Nanawadi"}}
-    };
-
-    // Find the matching factories based on the first match
-    for (const auto& matchingType : matchingTypes)
-    {
-        if (wasteFactories.find(matchingType) != wasteFactories.end())
+        else if (command == "road-profile")
         {
-            cout << "Recommended factories for waste type '" << matchingType << "':\n";
-            for (const auto& factory : wasteFactories[matchingType])
+            std::string from, name;
+            int to = 0;
+            ok = static_cast<bool>(args >> from);
+            if (ok && from == "all")
             {
-                cout << factory << "\n";
+                ok = (args >> name) && bwm.setRoadProfile(-1, -1, name);
+            }
+            else if (ok)
+            {
+                // Both must be area numbers: a typo must not become -1, which means every road
+                std::istringstream fromText(from);
+                int fromNumber = 0;
+                ok = (fromText >> fromNumber) && fromText.eof() && (args >> to >> name) &&
+                     fromNumber >= 1 && fromNumber <= bwm.getAreaCount() && to >= 1 && to <= bwm.getAreaCount() &&
+                     bwm.setRoadProfile(fromNumber - 1, to - 1, name);
             }
         }
-    }
-}
-
-// Function to display the main menu in a retro game-like style
-void displayMenu()
-{
-    int choice;
-    do {
-        // Print retro-style table with borders and menu options
-        std::cout << "\n";
-        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
-        std::cout << CYAN "|      " BOLD "WASTE MANAGEMENT SYSTEM MENU" RESET CYAN "      |" RESET << "\n";
-        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
-
-        // Menu options with colorful text
-        std::cout << YELLOW "| " RESET "1. " GREEN "View All Waste Records" RESET << "\n";
-        std::cout << YELLOW "| " RESET "2. " GREEN "Search Waste by Type" RESET << "\n";
-        std::cout << YELLOW "| " RESET "3. " GREEN "Sort Waste Records" RESET << "\n";
-        std::cout << YELLOW "| " RESET "4. " GREEN "Calculate Waste Statistics" RESET << "\n";
-        std::cout << YELLOW "| " RESET "5. " GREEN "Save Data to CSV" RESET << "\n";
-        std::cout << YELLOW "| " RESET "6. " GREEN "Add New Waste Record" RESET << "\n";
-        std::cout << YELLOW "| " RESET "7. " GREEN "Update Waste Record" RESET << "\n";
-        std::cout << YELLOW "| " RESET "8. " GREEN "Delete Waste Record" RESET << "\n";
-        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
-        std::cout << YELLOW "| " RESET "9. " GREEN "Select Waste Type for Factory" RESET << "\n"; // New case
-        std::cout << YELLOW "| " RESET "10. " GREEN "Send Waste to Factory" RESET << "\n";
-        std::cout << YELLOW "| " RESET "11. " GREEN "View Factory Records" RESET << "\n";
-        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
-        std::cout << YELLOW "| " RESET "12. " GREEN "Exit" RESET << "\n";
-        std::cout << CYAN "+----------------------------------------+" RESET << "\n";
-
-        // Prompt for user input
-        std::cout << BLUE "Enter your choice (1-12): " RESET;
-        std::cin >> choice;
-
-        // Menu logic
-        switch (choice)
+        else if (command == "fastest")
         {
-            // Waste Records Management
-            case 1:
-                displayWasteRecords();
-                break;
-            case 2:
-                searchWasteByType();
-                break;
-            case 3:
-                sortWasteRecords();
-                break;
-            case 4:
-                calculateStatistics();
-                break;
-            case 5:
-                saveToCSV("updated_waste_data.csv");
-                break;
-
-            // Waste Record Modification
-            case 6:
-                addNewWasteRecord();
-                break;
-            case 7:
-                updateWasteRecord();
-                break;
-            case 8:
-                deleteWasteRecord();
-                break;
-
-            // Factory and Waste Processing
-            case 9:
-                // New case: Select waste type before sending to the factory
-                selectFactoryForWasteType();
-                break;
-            case 10:
-                sendWasteToFactory();
-                break;
-            case 11:
-                viewFactoryRecords();
-                break;
-
-            // Exit the program
-            case 12:
-                std::cout << RED "Exiting... Goodbye!" RESET "\n";
-                break;
-
-            // Handle invalid choices
-            default:
-                std::cout << RED "Invalid choice. Please try again." RESET "\n";
-                break;
+            int areaNumber;
+            std::string clock;
+            double minute;
+            ok = (args >> areaNumber >> clock) && areaNumber >= 1 && areaNumber <= bwm.getAreaCount() &&
+                 parseClockTime(clock, minute);
+            if (ok)
+            {
+                bwm.findFastestRouteToDestination(0, areaNumber - 1, minute);
+            }
+        }
+        else if (command == "dispatch-time")
+        {
+            std::string clock;
+            double minute;
+            ok = (args >> clock) && parseClockTime(clock, minute) && bwm.setDispatchTime(minute);
+        }
+        else if (command == "coordinates")
+        {
+            int areaNumber;
+            double latitude, longitude;
+            ok = (args >> areaNumber >> latitude >> longitude) &&
+                 bwm.setAreaCoordinates(areaNumber - 1, latitude, longitude);
+        }
+        else if (command == "route-algorithm")
+        {
+            std::string name;
+            RouteAlgorithm algorithm;
+            ok = (args >> name) && parseRouteAlgorithm(name, algorithm);
+            if (ok)
+            {
+                bwm.setRouteAlgorithm(algorithm);
+            }
+        }
+        else if (command == "ch-build")
+        {
+            bwm.buildContractionHierarchy();
+        }
+        else if (command == "ch-save")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && bwm.saveContractionHierarchy(filename);
+        }
+        else if (command == "ch-load")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && bwm.loadContractionHierarchy(filename);
+        }
+        else if (command == "bench-route")
+        {
+            int queries = 100;
+            if (!(args >> queries))
+            {
+                queries = 100;
+            }
+            benchmarkRouteQueries(bwm, queries);
+        }
+        else if (command == "bench-closure")
+        {
+            int closures = 20;
+            if (!(args >> closures))
+            {
+                closures = 20;
+            }
+            benchmarkRoadClosures(bwm, closures);
+        }
+        else if (command == "bench-scenarios")
+        {
+            int piles = 40;
+            if (!(args >> piles))
+            {
+                piles = 40;
+            }
+            ok = piles > 0 && benchmarkScenarioRunner(bwm, piles);
+        }
+        else if (command == "bench-date")
+        {
+            int count = 1000000;
+            if (!(args >> count))
+            {
+                count = 1000000;
+            }
+            benchmarkDateParsing(count);
+        }
+        else if (command == "bench-area-lookup")
+        {
+            int maxAreas = 100000;
+            if (!(args >> maxAreas))
+            {
+                maxAreas = 100000;
+            }
+            benchmarkAreaLookup(maxAreas);
+        }
+        else if (command == "bench-longest")
+        {
+            int maxAreas = 18;
+            if (!(args >> maxAreas))
+            {
+                maxAreas = 18;
+            }
+            benchmarkLongestPath((std::min)(maxAreas, 64));
+        }
+        else if (command == "area")
+        {
+            std::string name, address, city;
+            ok = static_cast<bool>(args >> std::quoted(name) >> std::quoted(address) >> std::quoted(city));
+            if (ok)
+            {
+                database.addArea({name, address, city});
+            }
+        }
+        else if (command == "bench-csv")
+        {
+            int rows = 1000000;
+            if (!(args >> rows))
+            {
+                rows = 1000000;
+            }
+            benchmarkAreaCsv(rows);
+        }
+        else if (command == "bench-city")
+        {
+            int count = 1000000;
+            if (!(args >> count))
+            {
+                count = 1000000;
+            }
+            benchmarkCityFilter(count);
+        }
+        else if (command == "bench-stats")
+        {
+            int count = 10000000;
+            if (!(args >> count))
+            {
+                count = 10000000;
+            }
+            benchmarkPopulationStats(count);
+        }
+        else if (command == "areas-load")
+        {
+            std::string filename;
+            ok = (args >> std::quoted(filename)) && database.loadAreasFromFile(filename) >= 0;
+        }
+        else if (command == "population")
+        {
+            std::string areaName;
+            double population;
+            ok = (args >> std::quoted(areaName) >> population) && population >= 0;
+            if (ok)
+            {
+                database.setPopulation(areaName, population);
+            }
+        }
+        else if (command == "waste-generation")
+        {
+            double wastePerCapita = 0.74;
+            if (!(args >> wastePerCapita))
+            {
+                wastePerCapita = 0.74;
+            }
+            ok = wastePerCapita > 0 && database.printWasteGenerationTable(wastePerCapita);
+            if (ok)
+            {
+                std::cout << "Total waste generation for all areas (kg/day): "
+                          << database.totalWasteGeneration(wastePerCapita) << '\n';
+            }
+        }
+        else if (command == "waste-csv")
+        {
+            std::string filename;
+            ok = static_cast<bool>(args >> std::quoted(filename));
+            if (ok)
+            {
+                loadCSV(filename);
+            }
+        }
+        else if (command == "waste-record")
+        {
+            Wastes record;
+            int dayNumber;
+            ok = (args >> std::quoted(record.type) >> record.quantity >> std::quoted(record.location)
+                       >> std::quoted(record.date) >> std::quoted(record.condition)) && record.quantity > 0 &&
+                 parseDate(record.date, DateFormat::YearMonthDay, dayNumber);
+            if (ok)
+            {
+                wasteRecords.push_back(record);
+            }
+        }
+        else if (command == "send")
+        {
+            std::string wasteType, factoryName, factoryLocation;
+            int quantity;
+            ok = (args >> std::quoted(wasteType) >> quantity >> std::quoted(factoryName) >> std::quoted(factoryLocation)) &&
+                 sendWasteToFactory(wasteType, quantity, factoryName, factoryLocation) >= 0;
+        }
+        else if (command == "products")
+        {
+            std::string which;
+            ok = (args >> which) && which == "default";
+            if (ok)
+            {
+                products = defaultRecycledProducts();
+            }
+        }
+        else if (command == "cart-add")
+        {
+            std::string productName;
+            int quantity;
+            ok = (args >> std::quoted(productName) >> quantity) && quantity > 0;
+            if (ok)
+            {
+                auto it = std::find_if(products.begin(), products.end(), [&](const RecycledProduct& p) {
+                    return p.productName == productName;
+                });
+                ok = it != products.end();
+                if (ok)
+                {
+                    cart.push_back({*it, quantity});
+                }
+            }
+        }
+        else if (command == "checkout")
+        {
+            ok = !cart.empty();
+            if (ok)
+            {
+                double discount = 0.0;
+                double subtotal = calculateCheckoutTotal(cart, discount);
+                std::cout << "Checkout: subtotal " << subtotal << " Rupees, discount " << discount
+                          << " Rupees, final total " << subtotal - discount << " Rupees\n";
+                cart.clear();
+            }
+        }
+        else
+        {
+            report << "Line " << lineNumber << ": unknown command '" << command << "'\n";
+            errors++;
+            continue;
         }
-    } while (choice != 12);
-}
-
-
-// Main function to start the program
 
-int wastetofactory()
-{
-    // Ensure the file path is correctly formatted for Windows
-    std::string filePath = "C:\\MY CODES @KLES\\wastemagdata.csv";
+        if (ok)
+        {
+            operations++;
+        }
+        else
+        {
+            report << "Line " << lineNumber << ": command failed: " << line << '\n';
+            errors++;
+        }
+    }
 
-    // Load existing data from the file
-    loadCSV(filePath);
+    std::cout.rdbuf(consoleBuffer);
 
-    // Display the menu for user interactions
-    displayMenu();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    report << "Batch complete: " << operations << " operations, " << errors << " errors in "
+           << seconds << " s";
+    if (seconds > 0)
+    {
+        report << " (" << static_cast<long long>(operations / seconds) << " operations/s)";
+    }
+    report << std::endl;
 
-    return 0;
+    return errors == 0 ? 0 : 1;
 }
 
 
 
+
 // Function to display a welcome screen
 void setColor(int colorCode)
 {
@@ -5970,8 +12766,26 @@ void displayMainMenu()
 }
 
 // Main function
-int main()
+// Run with "--batch <jobfile>" (or "--batch -" for standard input) to skip the menus
+int main(int argc, char* argv[])
 {
+    if (argc >= 3 && string(argv[1]) == "--batch")
+    {
+        string jobFile = argv[2];
+        if (jobFile == "-")
+        {
+            return runBatch(cin);
+        }
+
+        ifstream jobs(jobFile);
+        if (!jobs)
+        {
+            cerr << "Error: Could not open job file " << jobFile << endl;
+            return 1;
+        }
+        return runBatch(jobs);
+    }
+
     // Display welcome screen
     displayWelcomeScreen();
 